@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mcstate {
+
+// A read-only view onto one entry of a packed parameter vector. The
+// data are stored in column-major order, as in R. The view holds its
+// own copy of the shape, so it remains valid if the packer it came
+// from is destroyed or has further entries added.
+template <typename real_type>
+class packer_view {
+public:
+  packer_view(const real_type * data, std::vector<size_t> shape) :
+    data_(data), shape_(std::move(shape)) {
+  }
+
+  const real_type& operator[](size_t i) const {
+    return data_[i];
+  }
+
+  const real_type& operator()(size_t i, size_t j) const {
+    return data_[i + j * shape_[0]];
+  }
+
+  const real_type& operator()(size_t i, size_t j, size_t k) const {
+    return data_[i + shape_[0] * (j + k * shape_[1])];
+  }
+
+  const real_type * data() const {
+    return data_;
+  }
+
+  const std::vector<size_t>& shape() const {
+    return shape_;
+  }
+
+private:
+  const real_type * data_;
+  std::vector<size_t> shape_;
+};
+
+// Describes where each named entry lives within a packed parameter
+// vector, mirroring the bookkeeping done by mcstate_packer() in R.
+class packer {
+public:
+  struct entry {
+    std::string name;
+    size_t offset;
+    size_t length;
+    std::vector<size_t> shape;
+  };
+
+  packer() : length_(0) {
+  }
+
+  void add(const std::string& name, std::vector<size_t> shape) {
+    size_t len = 1;
+    for (auto el : shape) {
+      len *= el;
+    }
+    entries_.push_back({name, length_, len, shape});
+    length_ += len;
+  }
+
+  size_t size() const {
+    return entries_.size();
+  }
+
+  size_t length() const {
+    return length_;
+  }
+
+  const entry& operator[](size_t i) const {
+    return entries_[i];
+  }
+
+  size_t index(const std::string& name) const {
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      if (entries_[i].name == name) {
+        return i;
+      }
+    }
+    throw std::runtime_error("Unknown packer entry '" + name + "'");
+  }
+
+  template <typename real_type>
+  packer_view<real_type> view(const real_type * x, size_t i) const {
+    return packer_view<real_type>(x + entries_[i].offset, entries_[i].shape);
+  }
+
+  template <typename real_type>
+  packer_view<real_type> view(const real_type * x,
+                              const std::string& name) const {
+    return view(x, index(name));
+  }
+
+private:
+  std::vector<entry> entries_;
+  size_t length_;
+};
+
+}
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "mcstate/particle/resample.hpp"
+#include "mcstate/random/prng.hpp"
+#include "mcstate/utils.hpp"
+
+namespace mcstate {
+namespace particle {
+
+/// A view onto the state of a single particle. Particle state is
+/// stored "structure of arrays", with all particles' values of the
+/// first variable, then all particles' values of the second, and so
+/// on, so that the particles can be updated in parallel with
+/// contiguous memory access. Element `j` of particle `i` is therefore
+/// at `data[i + j * n_particles]`, which this hides from the model.
+///
+/// @tparam T The element type; use `const real_type` for a read-only
+/// view
+template <typename T>
+class state_view {
+public:
+  state_view(T * data, size_t stride) : data_(data), stride_(stride) {
+  }
+
+  T& operator[](size_t j) const {
+    return data_[j * stride_];
+  }
+
+private:
+  T * data_;
+  size_t stride_;
+};
+
+/// A bootstrap particle filter, estimating the log-likelihood of a
+/// stochastic discrete-time model given a series of observations.
+///
+/// The model type `T` must provide the types `real_type`,
+/// `rng_state_type` and `data_type` (one observation) and the
+/// (const) methods:
+///
+/// * `size_t size()`: the number of state variables
+/// * `void initial(real_type time, rng_state_type& rng_state,
+///    state_view<real_type> state)`: set the initial state
+/// * `void update(real_type time, state_view<const real_type> state,
+///    rng_state_type& rng_state, state_view<real_type> state_next)`:
+///    advance the state by one unit of time
+/// * `real_type compare(real_type time, state_view<const real_type>
+///    state, const data_type& data, rng_state_type& rng_state)`: the
+///    log-likelihood of the data given the state, typically computed
+///    with the functions in `mcstate::density`
+///
+/// Each particle has its own random number stream and these stay
+/// with the particle's slot (not its state) over resampling; one
+/// further stream is used for resampling. As particles only ever use
+/// their own stream, the likelihood does not depend on the number of
+/// threads.
+///
+/// @tparam T The model type
+template <typename T>
+class filter {
+public:
+  using model_type = T;
+  using real_type = typename T::real_type;
+  using data_type = typename T::data_type;
+  using rng_state_type = typename T::rng_state_type;
+  using rng_int_type = typename rng_state_type::int_type;
+
+  /// Create a filter
+  ///
+  /// @param time_start The time that the model starts from; this
+  /// must be an integer
+  ///
+  /// @param time The times of the observations; these must be
+  /// integers (as the model is advanced one unit of time at a time),
+  /// increasing and after `time_start`
+  ///
+  /// @param data The observations, one per element of `time`
+  ///
+  /// @param n_particles The number of particles
+  ///
+  /// @param seed Seed for the random number generator, as for
+  /// `mcstate::random::prng`
+  ///
+  /// @param n_threads The number of threads to use
+  ///
+  /// @param method The resampling method
+  filter(real_type time_start, const std::vector<real_type>& time,
+         const std::vector<data_type>& data, size_t n_particles,
+         const std::vector<rng_int_type>& seed, int n_threads = 1,
+         resample_method method = resample_method::systematic) :
+    time_start_(time_start), time_(time), data_(data),
+    n_particles_(n_particles), n_threads_(n_threads), method_(method),
+    rng_(n_particles + 1, seed), resample_(n_threads),
+    log_weights_(n_particles), index_(n_particles),
+    errors_(n_particles) {
+    if (n_particles == 0) {
+      throw std::invalid_argument("Expected at least one particle");
+    }
+    if (time_.size() != data_.size()) {
+      throw std::invalid_argument("Expected 'time' and 'data' to be the same length");
+    }
+    if (!is_integer(time_start_)) {
+      throw std::invalid_argument("Expected 'time_start' to be an integer");
+    }
+    for (size_t k = 0; k < time_.size(); ++k) {
+      const real_type prev = k == 0 ? time_start_ : time_[k - 1];
+      if (!(time_[k] > prev)) {
+        throw std::invalid_argument("Expected 'time' to be increasing, and after 'time_start'");
+      }
+      if (!is_integer(time_[k])) {
+        throw std::invalid_argument("Expected 'time' to be integers");
+      }
+    }
+  }
+
+  /// Run the filter
+  ///
+  /// @param model The model, with its parameters
+  ///
+  /// @return The estimated log-likelihood; this is `-Inf` if at any
+  /// point no particle is consistent with the data
+  real_type run(const T& model) {
+    const size_t n = n_particles_;
+    const size_t n_state = model.size();
+    state_.resize(n_state * n);
+    state_next_.resize(n_state * n);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads_)
+#endif
+    for (size_t i = 0; i < n; ++i) {
+      try {
+        model.initial(time_start_, rng_.state(i), view(state_, i));
+      } catch (std::exception const& e) {
+        errors_.capture(e, i);
+      }
+    }
+    errors_.report("particles", 4, true);
+
+    const real_type log_n = std::log(static_cast<real_type>(n));
+    real_type ll = 0;
+    real_type time = time_start_;
+    for (size_t k = 0; k < time_.size(); ++k) {
+      for (; time < time_[k]; ++time) {
+        update(model, time);
+      }
+      compare(model, time, data_[k]);
+      const auto summary = summarise_log_weights<real_type>(log_weights_, n,
+                                                             n_threads_);
+      if (!(summary.sum > 0) || !std::isfinite(summary.log_sum())) {
+        return -std::numeric_limits<real_type>::infinity();
+      }
+      ll += summary.log_sum() - log_n;
+      resample_(rng_.state(n), log_weights_, summary, n, method_, index_);
+      reorder(n_state);
+    }
+    return ll;
+  }
+
+  /// The number of particles
+  size_t n_particles() const {
+    return n_particles_;
+  }
+
+  /// The state of all particles at the end of the last run, in the
+  /// layout described in `state_view`
+  const std::vector<real_type>& state() const {
+    return state_;
+  }
+
+  /// Export the random number state; this can be passed to
+  /// `set_rng_state` to restore the generator exactly
+  std::vector<rng_int_type> rng_state() const {
+    return rng_.export_state();
+  }
+
+  /// Set the random number state. If fewer streams are provided than
+  /// the filter needs, the remainder are created by jumping, as for
+  /// `mcstate::random::prng`
+  void set_rng_state(const std::vector<rng_int_type>& seed) {
+    rng_ = random::prng<rng_state_type>(n_particles_ + 1, seed);
+  }
+
+private:
+  static bool is_integer(real_type x) {
+    return std::isfinite(x) && std::floor(x) == x;
+  }
+
+  real_type time_start_;
+  std::vector<real_type> time_;
+  std::vector<data_type> data_;
+  size_t n_particles_;
+  int n_threads_;
+  resample_method method_;
+  random::prng<rng_state_type> rng_;
+  resampler<real_type> resample_;
+  std::vector<real_type> state_;
+  std::vector<real_type> state_next_;
+  std::vector<real_type> log_weights_;
+  std::vector<size_t> index_;
+  mcstate::utils::openmp_errors errors_;
+
+  state_view<real_type> view(std::vector<real_type>& x, size_t i) {
+    return state_view<real_type>(x.data() + i, n_particles_);
+  }
+
+  state_view<const real_type> view(const std::vector<real_type>& x,
+                                   size_t i) const {
+    return state_view<const real_type>(x.data() + i, n_particles_);
+  }
+
+  void update(const T& model, real_type time) {
+    const auto& state = state_;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads_)
+#endif
+    for (size_t i = 0; i < n_particles_; ++i) {
+      try {
+        model.update(time, view(state, i), rng_.state(i),
+                     view(state_next_, i));
+      } catch (std::exception const& e) {
+        errors_.capture(e, i);
+      }
+    }
+    errors_.report("particles", 4, true);
+    std::swap(state_, state_next_);
+  }
+
+  void compare(const T& model, real_type time, const data_type& data) {
+    const auto& state = state_;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads_)
+#endif
+    for (size_t i = 0; i < n_particles_; ++i) {
+      try {
+        log_weights_[i] = model.compare(time, view(state, i), data,
+                                        rng_.state(i));
+      } catch (std::exception const& e) {
+        errors_.capture(e, i);
+      }
+    }
+    errors_.report("particles", 4, true);
+  }
+
+  // Copy the resampled particles' state into place; this works one
+  // variable at a time so that both reads and writes stay within a
+  // single contiguous block.
+  void reorder(size_t n_state) {
+    const size_t n = n_particles_;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(n_threads_)
+#endif
+    for (size_t j = 0; j < n_state; ++j) {
+      const real_type * from = state_.data() + j * n;
+      real_type * to = state_next_.data() + j * n;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (size_t i = 0; i < n; ++i) {
+        to[i] = from[index_[i]];
+      }
+    }
+    std::swap(state_, state_next_);
+  }
+};
+
+}
+}
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "mcstate/particle/weights.hpp"
+#include "mcstate/random/exponential.hpp"
+#include "mcstate/random/generator.hpp"
+
+namespace mcstate {
+namespace particle {
+
+enum class resample_method {
+  systematic,  ///< One uniform, evenly spaced positions
+  stratified,  ///< One uniform within each of n even strata
+  residual,    ///< Deterministic copies, then multinomial on residuals
+  multinomial  ///< Independent draws
+};
+
+/// Resample particles given their log weights. This holds the
+/// workspace needed (the cumulative weights and the sorted positions
+/// at which they are sampled) so that it can be reused over many
+/// resampling steps without reallocating.
+///
+/// All methods work the same way: we compute the cumulative
+/// (unnormalised) weights, generate `n` sorted positions along them
+/// and then for each position find the particle whose interval
+/// contains it. Each stage is O(n).
+///
+/// For very large numbers of particles the cumulative sum and the
+/// search are split over threads. The cumulative sum is always
+/// computed in fixed-size blocks so the result does not depend on the
+/// number of threads used.
+///
+/// @tparam real_type The real type used for weights
+template <typename real_type>
+class resampler {
+public:
+  /// Create a resampler
+  ///
+  /// @param n_threads The number of threads to use within a single
+  /// resampling step, where there are enough particles to make this
+  /// worthwhile
+  resampler(int n_threads = 1) : n_threads_(n_threads) {
+  }
+
+  /// Resample
+  ///
+  /// @param rng_state The random number state; this is only ever used
+  /// from a single thread
+  ///
+  /// @param log_weights The log weights, `n` of them, which need not
+  /// be normalised
+  ///
+  /// @param n The number of particles
+  ///
+  /// @param method The resampling method
+  ///
+  /// @param index Destination for the `n` (0-based) indices of the
+  /// resampled particles; these are in increasing order for all
+  /// methods except `residual`
+  ///
+  /// @return The summary of the weights, from which the effective
+  /// sample size and log-likelihood contribution can be computed
+  template <typename rng_state_type, typename T, typename U>
+  weights_summary<real_type> operator()(rng_state_type& rng_state,
+                                        const T& log_weights, size_t n,
+                                        resample_method method, U& index) {
+    const auto summary = summarise_log_weights<real_type>(log_weights, n,
+                                                         n_threads_);
+    (*this)(rng_state, log_weights, summary, n, method, index);
+    return summary;
+  }
+
+  /// Resample, where the weights have already been summarised (e.g.,
+  /// to compute the log-likelihood before resampling); arguments are
+  /// as above, with `summary` the result of `summarise_log_weights`
+  template <typename rng_state_type, typename T, typename U>
+  void operator()(rng_state_type& rng_state, const T& log_weights,
+                  const weights_summary<real_type>& summary, size_t n,
+                  resample_method method, U& index) {
+    if (!(summary.sum > 0) || !std::isfinite(summary.log_sum())) {
+      mcstate::utils::fatal_error("Invalid particle weights");
+    }
+    cum_.resize(n);
+    pos_.resize(n);
+    cumulative_weights(log_weights, summary.max, n);
+    if (method == resample_method::residual) {
+      residual(rng_state, n, index);
+    } else {
+      positions(rng_state, n, method);
+      search(n, index, 0);
+    }
+  }
+
+private:
+  static constexpr size_t block_size = 4096;
+  // Below this many particles threading does not pay for itself
+  static constexpr size_t parallel_min = 65536;
+
+  int n_threads_;
+  std::vector<real_type> cum_;
+  std::vector<real_type> pos_;
+
+  int n_threads(size_t n) const {
+    return n < parallel_min ? 1 : n_threads_;
+  }
+
+  // cum_[i] is the sum of exp(w[j] - max) for j <= i
+  template <typename T>
+  void cumulative_weights(const T& log_weights, real_type max, size_t n) {
+    const size_t n_blocks = (n + block_size - 1) / block_size;
+    // Prefix sums within each block
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads(n))
+#endif
+    for (size_t b = 0; b < n_blocks; ++b) {
+      const size_t from = b * block_size, to = std::min(from + block_size, n);
+      real_type tot = 0;
+      for (size_t i = from; i < to; ++i) {
+        tot += std::exp(static_cast<real_type>(log_weights[i]) - max);
+        cum_[i] = tot;
+      }
+    }
+    // Then offset each block by the total of all previous blocks
+    if (n_blocks > 1) {
+      std::vector<real_type> offset(n_blocks, 0);
+      for (size_t b = 1; b < n_blocks; ++b) {
+        offset[b] = offset[b - 1] + cum_[b * block_size - 1];
+      }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads(n))
+#endif
+      for (size_t b = 1; b < n_blocks; ++b) {
+        const size_t from = b * block_size, to = std::min(from + block_size, n);
+        for (size_t i = from; i < to; ++i) {
+          cum_[i] += offset[b];
+        }
+      }
+    }
+  }
+
+  // Sorted positions on [0, total)
+  template <typename rng_state_type>
+  void positions(rng_state_type& rng_state, size_t n, resample_method method) {
+    const real_type total = cum_[n - 1];
+    const real_type step = total / n;
+    switch (method) {
+    case resample_method::systematic: {
+      const real_type u = random::random_real<real_type>(rng_state);
+      for (size_t j = 0; j < n; ++j) {
+        pos_[j] = (j + u) * step;
+      }
+      break;
+    }
+    case resample_method::stratified:
+      for (size_t j = 0; j < n; ++j) {
+        pos_[j] = (j + random::random_real<real_type>(rng_state)) * step;
+      }
+      break;
+    case resample_method::multinomial:
+    default: {
+      // Sorted uniforms from normalised exponential spacings
+      real_type s = 0;
+      for (size_t j = 0; j < n; ++j) {
+        s += random::exponential_rand<real_type>(rng_state);
+        pos_[j] = s;
+      }
+      s += random::exponential_rand<real_type>(rng_state);
+      const real_type scale = total / s;
+      for (size_t j = 0; j < n; ++j) {
+        pos_[j] *= scale;
+      }
+      break;
+    }
+    }
+  }
+
+  // For each position j >= from, find the first particle whose
+  // cumulative weight exceeds it. Each thread takes a contiguous run
+  // of positions, finds its first particle by bisection and then
+  // walks forward.
+  template <typename U>
+  void search(size_t n, U& index, size_t from) {
+    const int n_chunks = n_threads(n);
+    const size_t len = n - from;
+    // Rounding can put a position at (or beyond) the total weight;
+    // clamping just below it selects the last particle with non-zero
+    // weight.
+    const real_type top = std::nextafter(cum_[n - 1], static_cast<real_type>(0));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_chunks)
+#endif
+    for (int c = 0; c < n_chunks; ++c) {
+      const size_t j0 = from + len * c / n_chunks;
+      const size_t j1 = from + len * (c + 1) / n_chunks;
+      if (j0 == j1) {
+        continue;
+      }
+      size_t i = std::upper_bound(cum_.begin(), cum_.begin() + n,
+                                  std::min(pos_[j0], top)) - cum_.begin();
+      for (size_t j = j0; j < j1; ++j) {
+        const real_type p = std::min(pos_[j], top);
+        while (cum_[i] <= p) {
+          ++i;
+        }
+        index[j] = i;
+      }
+    }
+  }
+
+  // Residual resampling: floor(n * w_i) copies of each particle, and
+  // the remainder drawn by multinomial sampling on what is left over.
+  template <typename rng_state_type, typename U>
+  void residual(rng_state_type& rng_state, size_t n, U& index) {
+    const real_type scale = n / cum_[n - 1];
+    size_t k = 0;
+    real_type prev = 0;
+    for (size_t i = 0; i < n; ++i) {
+      const real_type nw = (cum_[i] - prev) * scale;
+      prev = cum_[i];
+      const size_t copies = std::min(static_cast<size_t>(nw), n - k);
+      for (size_t c = 0; c < copies; ++c) {
+        index[k++] = i;
+      }
+      // Replace the weights by the residuals, accumulated
+      cum_[i] = nw - copies + (i > 0 ? cum_[i - 1] : 0);
+    }
+    if (k < n) {
+      const size_t m = n - k;
+      const real_type total = cum_[n - 1];
+      real_type s = 0;
+      for (size_t j = 0; j < m; ++j) {
+        s += random::exponential_rand<real_type>(rng_state);
+        pos_[k + j] = s;
+      }
+      s += random::exponential_rand<real_type>(rng_state);
+      for (size_t j = 0; j < m; ++j) {
+        pos_[k + j] *= total / s;
+      }
+      search(n, index, k);
+    }
+  }
+};
+
+}
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "mcstate/random/math_array.hpp"
+
+namespace mcstate {
+namespace particle {
+
+/// Summary of a set of log weights. The sums are of `exp(w - max)`
+/// and its square, so nothing overflows however large the weights.
+template <typename real_type>
+struct weights_summary {
+  real_type max;
+  real_type sum;
+  real_type sum2;
+
+  /// The log of the sum of the (unnormalised) weights
+  real_type log_sum() const {
+    return max + std::log(sum);
+  }
+
+  /// The effective sample size, `sum(w)^2 / sum(w^2)`
+  real_type ess() const {
+    return sum * sum / sum2;
+  }
+};
+
+namespace {
+
+// Combine the summaries of two sets of weights
+template <typename real_type>
+weights_summary<real_type> combine(const weights_summary<real_type>& a,
+                                   const weights_summary<real_type>& b) {
+  if (b.sum == 0) {
+    return a;
+  } else if (a.sum == 0) {
+    return b;
+  }
+  const bool a_max = a.max >= b.max;
+  const auto& hi = a_max ? a : b;
+  const auto& lo = a_max ? b : a;
+  const real_type scale = std::exp(lo.max - hi.max);
+  return weights_summary<real_type>{hi.max,
+                                    hi.sum + lo.sum * scale,
+                                    hi.sum2 + lo.sum2 * scale * scale};
+}
+
+// Weights are exponentiated through a buffer of this many values,
+// using the array form of exp
+constexpr size_t weights_chunk_size = 256;
+// Partial sums and maxima are kept in this many independent lanes,
+// combined in a fixed order at the end. The lanes give the compiler
+// independent operations to vectorise without reassociating the
+// floating point sums (which it may not do), so the result is the
+// same whether or not it does.
+constexpr size_t weights_lanes = 4;
+
+// Summarise one block of weights. The block is small enough to stay
+// in cache, so we take the maximum in one sweep and then sum in a
+// second.
+template <typename real_type, typename T>
+weights_summary<real_type> summarise_block(const T& w, size_t from,
+                                           size_t to) {
+  constexpr size_t nl = weights_lanes;
+  const size_t n = to - from;
+  const size_t n_body = n - n % nl;
+
+  real_type lane_max[nl];
+  std::fill_n(lane_max, nl, -std::numeric_limits<real_type>::infinity());
+  for (size_t i = 0; i < n_body; i += nl) {
+    for (size_t k = 0; k < nl; ++k) {
+      const real_type x = w[from + i + k];
+      lane_max[k] = x > lane_max[k] ? x : lane_max[k];
+    }
+  }
+  real_type max = -std::numeric_limits<real_type>::infinity();
+  for (size_t i = n_body; i < n; ++i) {
+    max = std::max(max, static_cast<real_type>(w[from + i]));
+  }
+  for (size_t k = 0; k < nl; ++k) {
+    max = std::max(max, lane_max[k]);
+  }
+  if (max == -std::numeric_limits<real_type>::infinity()) {
+    return weights_summary<real_type>{max, 0, 0};
+  }
+
+  real_type lane_sum[nl] = {0}, lane_sum2[nl] = {0};
+  real_type e[weights_chunk_size];
+  for (size_t start = 0; start < n; start += weights_chunk_size) {
+    const size_t len = std::min(weights_chunk_size, n - start);
+    for (size_t i = 0; i < len; ++i) {
+      e[i] = static_cast<real_type>(w[from + start + i]) - max;
+    }
+    mcstate::math::exp(e, e, len);
+    // Pad the last chunk to a whole number of lanes
+    const size_t len_lanes = (len + nl - 1) / nl * nl;
+    std::fill(e + len, e + len_lanes, 0);
+    for (size_t i = 0; i < len_lanes; i += nl) {
+      for (size_t k = 0; k < nl; ++k) {
+        lane_sum[k] += e[i + k];
+        lane_sum2[k] += e[i + k] * e[i + k];
+      }
+    }
+  }
+  const real_type sum =
+    (lane_sum[0] + lane_sum[1]) + (lane_sum[2] + lane_sum[3]);
+  const real_type sum2 =
+    (lane_sum2[0] + lane_sum2[1]) + (lane_sum2[2] + lane_sum2[3]);
+  return weights_summary<real_type>{max, sum, sum2};
+}
+
+constexpr size_t weights_block_size = 4096;
+// Below this many weights threading does not pay for itself
+constexpr size_t weights_parallel_min = 65536;
+
+}
+
+/// Summarise the log weights `w[0], ..., w[n - 1]`, reading them only
+/// once. Weights of `-Inf` contribute nothing; if all weights are
+/// `-Inf` the sum is zero (and `log_sum()` is `-Inf`).
+///
+/// The weights are processed in fixed-size blocks whose summaries are
+/// combined in order, so the result is identical whatever the number
+/// of threads.
+///
+/// @param w The log weights
+///
+/// @param n The number of weights
+///
+/// @param n_threads The number of threads to use, for large `n`
+template <typename real_type, typename T>
+weights_summary<real_type> summarise_log_weights(const T& w, size_t n,
+                                                 int n_threads = 1) {
+  const size_t n_blocks = (n + weights_block_size - 1) / weights_block_size;
+  if (n_blocks <= 1) {
+    return summarise_block<real_type>(w, 0, n);
+  }
+  std::vector<weights_summary<real_type>> block(n_blocks);
+  const int n_threads_use = n < weights_parallel_min ? 1 : n_threads;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads_use)
+#endif
+  for (size_t b = 0; b < n_blocks; ++b) {
+    const size_t from = b * weights_block_size;
+    const size_t to = std::min(from + weights_block_size, n);
+    block[b] = summarise_block<real_type>(w, from, to);
+  }
+  auto ret = block[0];
+  for (size_t b = 1; b < n_blocks; ++b) {
+    ret = combine(ret, block[b]);
+  }
+  return ret;
+}
+
+/// The log of the sum of the exponentials of `w[0], ..., w[n - 1]`,
+/// computed stably; see `summarise_log_weights`
+template <typename real_type, typename T>
+real_type log_sum_exp(const T& w, size_t n, int n_threads = 1) {
+  return summarise_log_weights<real_type>(w, n, n_threads).log_sum();
+}
+
+/// Convert log weights into normalised weights (summing to one), in
+/// place. If all weights are `-Inf` the result is all `NaN`.
+///
+/// @return The summary of the weights before normalisation
+template <typename real_type, typename T>
+weights_summary<real_type> normalise_log_weights(T& w, size_t n,
+                                                 int n_threads = 1) {
+  const auto summary = summarise_log_weights<real_type>(w, n, n_threads);
+  const real_type log_sum = summary.log_sum();
+  const int n_threads_use = n < weights_parallel_min ? 1 : n_threads;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads_use)
+#endif
+  for (size_t i = 0; i < n; ++i) {
+    w[i] = std::exp(w[i] - log_sum);
+  }
+  return summary;
+}
+
+/// The effective sample size of the log weights `w[0], ..., w[n - 1]`
+template <typename real_type, typename T>
+real_type effective_sample_size(const T& w, size_t n, int n_threads = 1) {
+  return summarise_log_weights<real_type>(w, n, n_threads).ess();
+}
+
+}
+}
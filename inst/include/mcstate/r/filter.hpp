@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstring> // memcpy
+#include <string>
+#include <vector>
+
+#include <cpp11/doubles.hpp>
+#include <cpp11/external_pointer.hpp>
+#include <cpp11/list.hpp>
+#include <cpp11/raws.hpp>
+
+#include "mcstate/particle/filter.hpp"
+#include "mcstate/r/random.hpp"
+
+namespace mcstate {
+namespace r {
+
+inline mcstate::particle::resample_method as_resample_method(std::string method) {
+  if (method == "systematic") {
+    return mcstate::particle::resample_method::systematic;
+  } else if (method == "stratified") {
+    return mcstate::particle::resample_method::stratified;
+  } else if (method == "residual") {
+    return mcstate::particle::resample_method::residual;
+  } else if (method == "multinomial") {
+    return mcstate::particle::resample_method::multinomial;
+  }
+  cpp11::stop("Unknown resampling method '%s'", method.c_str());
+}
+
+// These functions provide the glue between a compiled model and
+// mcstate_model(); a package providing a model of type T registers
+// one function wrapping each of these, and from R uses
+// filter_run as the model's density and filter_rng_state /
+// filter_set_rng_state as its get_rng_state / set_rng_state.
+//
+// In addition to the requirements of mcstate::particle::filter, the
+// model must provide two static methods to convert from R:
+//
+// * `T build(cpp11::doubles pars)`: create the model from a
+//   parameter vector
+// * `data_type build_data(cpp11::list data)`: convert one observation
+
+/// Create a particle filter, returning an external pointer
+///
+/// @param time_start The start time
+///
+/// @param r_time The times of each observation
+///
+/// @param r_data A list of observations, the same length as `r_time`
+///
+/// @param n_particles The number of particles
+///
+/// @param n_threads The number of threads
+///
+/// @param r_seed The seed, in any format accepted by
+/// `mcstate::random::r::as_rng_seed`
+///
+/// @param method The resampling method
+template <typename T>
+SEXP filter_alloc(double time_start, cpp11::doubles r_time, cpp11::list r_data,
+                  int n_particles, int n_threads, cpp11::sexp r_seed,
+                  std::string method) {
+  using real_type = typename T::real_type;
+  using data_type = typename T::data_type;
+  using rng_state_type = typename T::rng_state_type;
+  if (r_time.size() != r_data.size()) {
+    cpp11::stop("Expected 'time' and 'data' to be the same length");
+  }
+  if (n_particles < 1) {
+    cpp11::stop("Expected at least one particle");
+  }
+  std::vector<real_type> time(r_time.begin(), r_time.end());
+  std::vector<data_type> data;
+  data.reserve(r_data.size());
+  for (auto el : r_data) {
+    data.push_back(T::build_data(cpp11::as_cpp<cpp11::list>(el)));
+  }
+  auto seed = mcstate::random::r::as_rng_seed<rng_state_type>(r_seed);
+  auto *obj = new mcstate::particle::filter<T>(time_start, time, data,
+                                               n_particles, seed, n_threads,
+                                               as_resample_method(method));
+  return cpp11::external_pointer<mcstate::particle::filter<T>>(obj);
+}
+
+/// Run a particle filter, returning the log-likelihood
+template <typename T>
+double filter_run(cpp11::sexp ptr, cpp11::doubles pars) {
+  auto *obj =
+    cpp11::as_cpp<cpp11::external_pointer<mcstate::particle::filter<T>>>(ptr).get();
+  return obj->run(T::build(pars));
+}
+
+/// Get the random number state of a particle filter, as a raw vector
+template <typename T>
+cpp11::sexp filter_rng_state(cpp11::sexp ptr) {
+  using int_type = typename T::rng_state_type::int_type;
+  auto *obj =
+    cpp11::as_cpp<cpp11::external_pointer<mcstate::particle::filter<T>>>(ptr).get();
+  const auto state = obj->rng_state();
+  const size_t len = sizeof(int_type) * state.size();
+  cpp11::writable::raws ret(len);
+  std::memcpy(RAW(ret), state.data(), len);
+  return ret;
+}
+
+/// Set the random number state of a particle filter from a raw
+/// vector; this may be the full state from `filter_rng_state` or a
+/// shorter seed, such as the single stream passed from a sampler
+template <typename T>
+void filter_set_rng_state(cpp11::sexp ptr, cpp11::raws r_state) {
+  using rng_state_type = typename T::rng_state_type;
+  auto *obj =
+    cpp11::as_cpp<cpp11::external_pointer<mcstate::particle::filter<T>>>(ptr).get();
+  obj->set_rng_state(mcstate::random::r::raw_seed<rng_state_type>(r_state));
+}
+
+}
+}
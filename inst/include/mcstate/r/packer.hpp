@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cpp11/integers.hpp>
+#include <cpp11/list.hpp>
+#include <cpp11/strings.hpp>
+
+#include "mcstate/packer.hpp"
+
+namespace mcstate {
+namespace r {
+
+/// Create a packer from the `layout` element of an R `mcstate_packer`
+/// object, so that compiled model code can read parameters directly
+/// from the packed vector rather than from the unpacked list.
+inline mcstate::packer as_packer(cpp11::list layout) {
+  const cpp11::strings names = layout["names"];
+  const cpp11::list shape = layout["shape"];
+  mcstate::packer ret;
+  for (R_xlen_t i = 0; i < names.size(); ++i) {
+    const cpp11::integers shape_i = shape[i];
+    ret.add(std::string(names[i]),
+            std::vector<size_t>(shape_i.begin(), shape_i.end()));
+  }
+  return ret;
+}
+
+}
+}
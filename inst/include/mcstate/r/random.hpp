@@ -11,6 +11,7 @@
 
 #include "mcstate/random/generator.hpp"
 #include "mcstate/random/prng.hpp"
+#include "mcstate/random/serialise.hpp"
 
 namespace mcstate {
 namespace random {
@@ -68,37 +69,6 @@ std::vector<typename rng_state_type::int_type> as_rng_seed(cpp11::sexp r_seed) {
 
 namespace {
 
-template<typename T>
-std::string algorithm_name() {
-  std::string ret;
-  if (std::is_same<T, xoshiro128plus>::value) {
-    ret = "xoshiro128plus";
-  } else if (std::is_same<T, xoshiro128plusplus>::value) {
-    ret = "xoshiro128plusplus";
-  } else if (std::is_same<T, xoshiro128starstar>::value) {
-    ret = "xoshiro128starstar";
-  } else if (std::is_same<T, xoroshiro128plus>::value) {
-    ret = "xoroshiro128plus";
-  } else if (std::is_same<T, xoroshiro128plusplus>::value) {
-    ret = "xoroshiro128plusplus";
-  } else if (std::is_same<T, xoroshiro128starstar>::value) {
-    ret = "xoroshiro128starstar";
-  } else if (std::is_same<T, xoshiro256plus>::value) {
-    ret = "xoshiro256plus";
-  } else if (std::is_same<T, xoshiro256plusplus>::value) {
-    ret = "xoshiro256plusplus";
-  } else if (std::is_same<T, xoshiro256starstar>::value) {
-    ret = "xoshiro256starstar";
-  } else if (std::is_same<T, xoshiro512plus>::value) {
-    ret = "xoshiro512plus";
-  } else if (std::is_same<T, xoshiro512plusplus>::value) {
-    ret = "xoshiro512plusplus";
-  } else if (std::is_same<T, xoshiro512starstar>::value) {
-    ret = "xoshiro512starstar";
-  }
-  return ret;
-}
-
 template <typename rng_state_type>
 cpp11::raws rng_state_vector(prng<rng_state_type>* rng) {
   auto state = rng->export_state();
@@ -122,6 +92,43 @@ SEXP rng_pointer_init(int n_streams, cpp11::sexp r_seed, int long_jump) {
   return cpp11::writable::list({r_ptr, r_state});
 }
 
+/// Compute the state for a distributed parallel random number
+/// generator, as a list of `n_nodes` raw vectors each holding
+/// `n_streams` streams. Node `i`'s streams are node `i - 1`'s
+/// streams advanced by one long jump; this is equivalent to (but much
+/// cheaper than) repeatedly calling `rng_pointer_init` with
+/// `long_jump = 1` on the previous node's state.
+template <typename rng_state_type>
+cpp11::writable::list rng_distributed_state(cpp11::sexp r_seed,
+                                            int n_streams, int n_nodes) {
+  using int_type = typename rng_state_type::int_type;
+  constexpr size_t len = rng_state_type::size();
+  constexpr size_t len_bytes = len * sizeof(int_type);
+  auto seed = as_rng_seed<rng_state_type>(r_seed);
+  prng<rng_state_type> rng(n_streams, seed);
+
+  std::vector<cpp11::writable::raws> state;
+  for (int i = 0; i < n_nodes; ++i) {
+    state.push_back(cpp11::writable::raws(n_streams * len_bytes));
+  }
+
+  for (int j = 0; j < n_streams; ++j) {
+    auto s = rng.state(j);
+    for (int i = 0; i < n_nodes; ++i) {
+      if (i > 0) {
+        long_jump(s);
+      }
+      std::memcpy(RAW(state[i]) + j * len_bytes, s.state, len_bytes);
+    }
+  }
+
+  cpp11::writable::list ret(n_nodes);
+  for (int i = 0; i < n_nodes; ++i) {
+    ret[i] = state[i];
+  }
+  return ret;
+}
+
 /// Recieve and check the pointer to rng state.  This checks that the
 /// object is valid, is of the correct state type, has sufficient
 /// streams and has not been invalidated by serialisation.
@@ -177,6 +184,33 @@ prng<rng_state_type>* rng_pointer_get(cpp11::environment obj,
   return rng;
 }
 
+/// Write the state of an `mcstate_rng_pointer` object to a file in
+/// the compact binary format of `mcstate::random::save_state`. This
+/// avoids materialising the state as an R raw vector, which is
+/// expensive for very large numbers of streams.
+template <typename rng_state_type>
+void rng_pointer_save(cpp11::environment obj, std::string filename) {
+  cpp11::environment env_enclos =
+    cpp11::as_cpp<cpp11::environment>(obj[".__enclos_env__"]);
+  cpp11::environment env =
+    cpp11::as_cpp<cpp11::environment>(env_enclos["private"]);
+  // Saving does not modify the state, so preserve its currency
+  const auto is_current = cpp11::as_cpp<bool>(env["is_current_"]);
+  auto * rng = rng_pointer_get<rng_state_type>(obj);
+  save_state(*rng, filename);
+  env["is_current_"] = cpp11::as_sexp(is_current);
+}
+
+/// Replace the state of an `mcstate_rng_pointer` object with state
+/// previously written by `rng_pointer_save`; the algorithm and number
+/// of streams must match. The state is copied directly from the file
+/// into the generator.
+template <typename rng_state_type>
+void rng_pointer_load(cpp11::environment obj, std::string filename) {
+  auto * rng = rng_pointer_get<rng_state_type>(obj);
+  load_state(filename, *rng);
+}
+
 template <typename rng_state_type>
 void rng_pointer_sync(cpp11::environment obj) {
   using ptr_type = cpp11::external_pointer<prng<rng_state_type>>;
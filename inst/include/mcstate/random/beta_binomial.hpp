@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "mcstate/random/binomial.hpp"
+#include "mcstate/random/density.hpp"
+#include "mcstate/random/gamma.hpp"
+#include "mcstate/random/generator.hpp"
+#include "mcstate/random/numeric.hpp"
+
+namespace mcstate {
+namespace random {
+
+namespace {
+
+template <typename real_type>
+void beta_binomial_validate(real_type size, real_type prob, real_type rho) {
+  if (!(size >= 0) || !(prob >= 0 && prob <= 1) || !(rho > 0 && rho < 1)) {
+    char buffer[256];
+    snprintf(buffer, 256,
+             "Invalid call to beta_binomial with size = %g, prob = %g, rho = %g",
+             size, prob, rho);
+    mcstate::utils::fatal_error(buffer);
+  }
+}
+
+// Below this mean (taken from whichever tail is lighter) we sample by
+// inversion, as for nbinomial; above it we draw the probability from
+// the beta distribution and then a binomial.
+template <typename real_type>
+constexpr real_type beta_binomial_inversion_max_mean() {
+  return 30;
+}
+
+// Draw from the beta distribution as a ratio of gamma draws
+template <typename real_type, typename rng_state_type>
+real_type beta_gamma(rng_state_type& rng_state, real_type a, real_type b) {
+  const real_type x = gamma<real_type>(rng_state, a, 1);
+  const real_type y = gamma<real_type>(rng_state, b, 1);
+  if (x + y == 0) {
+    // Both shapes so small that the draws underflowed; in this limit
+    // all the mass is at 0 or 1.
+    return random_real<real_type>(rng_state) * (a + b) < a ? 1 : 0;
+  }
+  return x / (x + y);
+}
+
+}
+
+/// Draw from the beta-binomial distribution with fixed parameters.
+/// The parameterisation matches `density::beta_binomial`: `prob` is
+/// the mean probability of success, `a / (a + b)`, and `rho` the
+/// overdispersion, `1 / (a + b + 1)`.
+///
+/// Where the mean is small we sample by inversion from a single
+/// uniform random number; the setup (which needs the log-beta
+/// function) is done once on construction so this is much cheaper
+/// than calling `beta_binomial()` repeatedly with the same
+/// parameters. Otherwise we draw a beta-distributed probability and
+/// then a binomial.
+///
+/// The draws are identical to those from `beta_binomial()`.
+///
+/// @tparam real_type The underlying real number type, typically
+/// `double` or `float`.
+template <typename real_type>
+class beta_binomial_sampler {
+public:
+  /// Construct a sampler
+  ///
+  /// @param size The number of trials
+  ///
+  /// @param prob The mean probability of success on each trial
+  ///
+  /// @param rho The overdispersion parameter, on (0, 1)
+  beta_binomial_sampler(real_type size, real_type prob, real_type rho) :
+    size_(std::round(size)), mean_(size * prob), p0_(0) {
+    static_assert(std::is_floating_point<real_type>::value,
+                  "Only valid for floating-point types");
+    beta_binomial_validate(size, prob, rho);
+    // Work from the lighter tail, drawing the number of failures
+    // where success is more likely, so that inversion is short.
+    flip_ = prob > 0.5;
+    const real_type p = flip_ ? 1 - prob : prob;
+    a_ = p * (1 / rho - 1);
+    b_ = (1 - p) * (1 / rho - 1);
+    if (size_ == 0 || p == 0) {
+      algorithm_ = algorithm::none;
+    } else if (size_ * p < beta_binomial_inversion_max_mean<real_type>()) {
+      algorithm_ = algorithm::inversion;
+      p0_ = std::exp(density::lbeta(a_, size_ + b_) - density::lbeta(a_, b_));
+    } else {
+      algorithm_ = algorithm::beta;
+    }
+  }
+
+  /// Draw a single number
+  ///
+  /// @param rng_state Reference to the random number state, will be
+  /// modified as a side-effect
+  template <typename rng_state_type>
+  real_type operator()(rng_state_type& rng_state) const {
+    if (rng_state.deterministic) {
+      return mean_;
+    }
+    real_type x;
+    switch (algorithm_) {
+    case algorithm::inversion:
+      x = inversion(rng_state);
+      break;
+    case algorithm::beta:
+      x = binomial<real_type>(rng_state, size_,
+                              beta_gamma<real_type>(rng_state, a_, b_));
+      break;
+    case algorithm::none:
+    default:
+      x = 0;
+    }
+    return flip_ ? size_ - x : x;
+  }
+
+  /// Draw `n` numbers into `dest`, choosing the algorithm once for
+  /// the whole batch
+  ///
+  /// @tparam T The type written to `dest`, which need not be
+  /// `real_type` (e.g., `double` when called from R with single
+  /// precision generators)
+  ///
+  /// @param rng_state Reference to the random number state, will be
+  /// modified as a side-effect
+  ///
+  /// @param dest Destination, with space for `n` values
+  ///
+  /// @param n The number of draws
+  template <typename rng_state_type, typename T>
+  void operator()(rng_state_type& rng_state, T * dest, size_t n) const {
+    if (rng_state.deterministic) {
+      std::fill_n(dest, n, mean_);
+      return;
+    }
+    switch (algorithm_) {
+    case algorithm::inversion:
+      for (size_t i = 0; i < n; ++i) {
+        const real_type x = inversion(rng_state);
+        dest[i] = flip_ ? size_ - x : x;
+      }
+      break;
+    case algorithm::beta:
+      for (size_t i = 0; i < n; ++i) {
+        const real_type x =
+          binomial<real_type>(rng_state, size_,
+                              beta_gamma<real_type>(rng_state, a_, b_));
+        dest[i] = flip_ ? size_ - x : x;
+      }
+      break;
+    case algorithm::none:
+    default:
+      std::fill_n(dest, n, flip_ ? size_ : 0);
+    }
+  }
+
+private:
+  enum class algorithm {none, inversion, beta};
+  real_type size_;
+  real_type mean_;
+  bool flip_;
+  real_type a_;
+  real_type b_;
+  algorithm algorithm_;
+  real_type p0_;
+
+  // Sequential search of the cdf, using the ratio of successive
+  // probabilities
+  template <typename rng_state_type>
+  real_type inversion(rng_state_type& rng_state) const {
+    const real_type u = random_real<real_type>(rng_state);
+    const real_type mean = size_ * a_ / (a_ + b_);
+    real_type p = p0_;
+    real_type cdf = p0_;
+    real_type x = 0;
+    while (u > cdf && x < size_) {
+      p *= (size_ - x) * (x + a_) / ((x + 1) * (size_ - x - 1 + b_));
+      cdf += p;
+      x++;
+      // As for nbinomial_inversion, guard against rounding leaving
+      // the cdf just short of a uniform very close to 1
+      if (x > mean && p < cdf * utils::epsilon<real_type>()) {
+        break;
+      }
+    }
+    return x;
+  }
+};
+
+/// Draw random number from the beta-binomial distribution; this is a
+/// binomial distribution whose probability of success is itself
+/// drawn from a beta distribution, and is parameterised as for
+/// `density::beta_binomial` (see `beta_binomial_sampler`).
+///
+/// @tparam real_type The underlying real number type, typically
+/// `double` or `float`.
+///
+/// @tparam rng_state_type The random number state type
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param size The number of trials
+///
+/// @param prob The mean probability of success on each trial
+///
+/// @param rho The overdispersion parameter, on (0, 1)
+template <typename real_type, typename rng_state_type>
+real_type beta_binomial(rng_state_type& rng_state, real_type size,
+                        real_type prob, real_type rho) {
+#ifdef __CUDA_ARCH__
+  static_assert("beta_binomial() not implemented for GPU targets");
+#endif
+  if (rng_state.deterministic) {
+    beta_binomial_validate(size, prob, rho);
+    return size * prob;
+  }
+  return beta_binomial_sampler<real_type>(size, prob, rho)(rng_state);
+}
+
+/// Draw one sample from the Dirichlet-multinomial distribution; this
+/// is a multinomial distribution whose probabilities are themselves
+/// drawn from a Dirichlet distribution, and generalises
+/// `beta_binomial` to more than two outcomes.
+///
+/// We draw the Dirichlet probabilities as normalised gamma draws and
+/// then the multinomial as a chain of binomials, as in
+/// `multinomial`; the gamma draws are held in `ret` until they are
+/// replaced by the counts so no extra storage is needed.
+///
+/// @tparam real_type The underlying real number type, typically
+/// `double` or `float`.
+///
+/// @tparam rng_state_type The random number state type
+///
+/// @tparam T,U The type of the containers for `alpha` and `ret`
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param size The number of trials
+///
+/// @param alpha The concentration parameter for each outcome; these
+/// must be non-negative, with a positive sum
+///
+/// @param len The number of outcomes
+///
+/// @param ret Container for the return value
+template <typename real_type, typename rng_state_type,
+          typename T, typename U>
+void dirichlet_multinomial(rng_state_type& rng_state, real_type size,
+                           const T& alpha, int len, U& ret) {
+  real_type alpha_tot = 0;
+  for (int i = 0; i < len; ++i) {
+    if (!(alpha[i] >= 0)) {
+      mcstate::utils::fatal_error("Invalid call to dirichlet_multinomial with alpha < 0");
+    }
+    alpha_tot += alpha[i];
+  }
+  if (!(alpha_tot > 0) || !(size >= 0)) {
+    mcstate::utils::fatal_error("Invalid call to dirichlet_multinomial with size < 0 or sum(alpha) = 0");
+  }
+
+  if (rng_state.deterministic) {
+    for (int i = 0; i < len; ++i) {
+      ret[i] = size * alpha[i] / alpha_tot;
+    }
+    return;
+  }
+
+  real_type g_tot = 0;
+  for (int i = 0; i < len; ++i) {
+    ret[i] = gamma<real_type>(rng_state, alpha[i], 1);
+    g_tot += ret[i];
+  }
+
+  if (g_tot == 0) {
+    // All the concentrations are so small that every draw
+    // underflowed; in this limit all trials fall in a single
+    // category, chosen with probability proportional to alpha.
+    real_type u = random_real<real_type>(rng_state) * alpha_tot;
+    int k = len - 1;
+    for (int i = 0; i < len - 1; ++i) {
+      u -= alpha[i];
+      if (u < 0) {
+        k = i;
+        break;
+      }
+    }
+    for (int i = 0; i < len; ++i) {
+      ret[i] = i == k ? size : 0;
+    }
+    return;
+  }
+
+  real_type size_rem = std::round(size);
+  for (int i = 0; i < len - 1; ++i) {
+    const real_type g_i = ret[i];
+    if (size_rem > 0 && g_i > 0) {
+      const real_type p = std::min<real_type>(g_i / g_tot, 1);
+      ret[i] = binomial<real_type>(rng_state, size_rem, p);
+    } else {
+      ret[i] = 0;
+    }
+    g_tot -= g_i;
+    size_rem -= ret[i];
+  }
+  if (len > 0) {
+    ret[len - 1] = size_rem;
+  }
+}
+
+// These ones are designed for us within standalone programs and won't
+// actually be tested by default which is not great.
+template <typename real_type, typename rng_state_type>
+void dirichlet_multinomial(rng_state_type& rng_state, real_type size,
+                           const std::vector<real_type>& alpha,
+                           std::vector<real_type>& ret) {
+  dirichlet_multinomial(rng_state, size, alpha, alpha.size(), ret);
+}
+
+template <typename real_type, typename rng_state_type>
+std::vector<real_type> dirichlet_multinomial(rng_state_type& rng_state,
+                                             real_type size,
+                                             const std::vector<real_type>& alpha) {
+  std::vector<real_type> ret(alpha.size());
+  dirichlet_multinomial(rng_state, size, alpha, ret);
+  return ret;
+}
+
+}
+}
@@ -5,6 +5,7 @@
 
 #include "mcstate/random/binomial_gamma_tables.hpp"
 #include "mcstate/random/generator.hpp"
+#include "mcstate/random/lanes.hpp"
 #include "mcstate/random/math.hpp"
 
 namespace mcstate {
@@ -133,27 +134,95 @@ __host__ __device__ inline double stirling_approx_tail(double k) {
   return tail;
 }
 
-// https://www.tandfonline.com/doi/abs/10.1080/00949659308811496
-__nv_exec_check_disable__
-template <typename real_type, typename rng_state_type>
-inline __host__ __device__
-real_type btrs(rng_state_type& rng_state, real_type n, real_type p) {
-  const real_type one = 1.0;
-  const real_type half = 0.5;
+// Constants used by BTRS that depend only on the parameters
+template <typename real_type>
+struct btrs_constants {
+  real_type n;
+  real_type b;
+  real_type a;
+  real_type c;
+  real_type v_r;
+  real_type r;
+  real_type alpha;
+  real_type m;
+};
 
+template <typename real_type>
+__host__ __device__
+btrs_constants<real_type> btrs_setup(real_type n, real_type p) {
+  const real_type half = 0.5;
+  btrs_constants<real_type> x;
   // This is spq in the paper.
   const real_type stddev = mcstate::math::sqrt(n * p * (1 - p));
 
   // Other coefficients for Transformed Rejection sampling.
-  const real_type b = static_cast<real_type>(1.15) + static_cast<real_type>(2.53) * stddev;
-  const real_type a = static_cast<real_type>(-0.0873) + static_cast<real_type>(0.0248) * b + static_cast<real_type>(0.01) * p;
-  const real_type c = n * p + half;
-  const real_type v_r = static_cast<real_type>(0.92) - static_cast<real_type>(4.2) / b;
-  const real_type r = p / (1 - p);
+  x.n = n;
+  x.b = static_cast<real_type>(1.15) + static_cast<real_type>(2.53) * stddev;
+  x.a = static_cast<real_type>(-0.0873) + static_cast<real_type>(0.0248) * x.b + static_cast<real_type>(0.01) * p;
+  x.c = n * p + half;
+  x.v_r = static_cast<real_type>(0.92) - static_cast<real_type>(4.2) / x.b;
+  x.r = p / (1 - p);
+  x.alpha = (static_cast<real_type>(2.83) +
+             static_cast<real_type>(5.1) / x.b) * stddev;
+  x.m = std::floor((n + 1) * p);
+  return x;
+}
+
+// The transformation whose floor is the candidate draw, given u
+// shifted onto [-0.5, 0.5) and us = 0.5 - |u|
+template <typename real_type>
+__host__ __device__
+inline real_type btrs_transform(real_type a, real_type b, real_type c,
+                                real_type u, real_type us) {
+  return (2 * a / us + b) * u + c;
+}
 
-  const real_type alpha = (static_cast<real_type>(2.83) +
-                           static_cast<real_type>(5.1) / b) * stddev;
-  const real_type m = std::floor((n + 1) * p);
+// Region for which the box is tight, and we can return our calculated
+// value This should happen 0.86 * v_r times. In the limit as n * p is
+// large, the acceptance rate converges to ~79% (and in the lower
+// regime it is ~24%).
+template <typename real_type>
+__host__ __device__
+inline bool btrs_box(real_type v_r, real_type v, real_type us) {
+  return (us >= static_cast<real_type>(0.07)) & (v <= v_r);
+}
+
+// The test for a candidate 'k' outside the box; this is the slow path
+template <typename real_type>
+__host__ __device__
+bool btrs_accept(const btrs_constants<real_type>& x, real_type v,
+                 real_type us, real_type k) {
+  const real_type one = 1.0;
+  const real_type half = 0.5;
+  const real_type n = x.n;
+  const real_type m = x.m;
+  const real_type r = x.r;
+
+  // Reject non-sensical answers.
+  if (k < 0 || k > n) {
+    return false;
+  }
+
+  // This deviates from Hormann's BRTS algorithm, as there is a log missing.
+  // For all (u, v) pairs outside of the bounding box, this calculates the
+  // transformed-reject ratio.
+  v = mcstate::math::log(v * x.alpha / (x.a / (us * us) + x.b));
+  real_type upperbound =
+    ((m + half) * mcstate::math::log((m + 1) / (r * (n - m + 1))) +
+     (n + one) * mcstate::math::log((n - m + 1) / (n - k + 1)) +
+     (k + half) * mcstate::math::log(r * (n - k + 1) / (k + 1)) +
+     stirling_approx_tail(m) + stirling_approx_tail(n - m) -
+     stirling_approx_tail(k) - stirling_approx_tail(n - k));
+  return v <= upperbound;
+}
+
+// https://www.tandfonline.com/doi/abs/10.1080/00949659308811496
+__nv_exec_check_disable__
+template <typename real_type, typename rng_state_type>
+inline __host__ __device__
+real_type btrs(rng_state_type& rng_state, real_type n, real_type p) {
+  const real_type half = 0.5;
+  const auto x = btrs_setup(n, p);
 
   real_type draw;
   while (true) {
@@ -161,33 +230,8 @@ real_type btrs(rng_state_type& rng_state, real_type n, real_type p) {
     real_type v = random_real<real_type>(rng_state);
     u -= half;
     real_type us = half - mcstate::math::abs(u);
-    real_type k = std::floor((2 * a / us + b) * u + c);
-
-    // Region for which the box is tight, and we
-    // can return our calculated value This should happen
-    // 0.86 * v_r times. In the limit as n * p is large,
-    // the acceptance rate converges to ~79% (and in the lower
-    // regime it is ~24%).
-    if (us >= static_cast<real_type>(0.07) && v <= v_r) {
-      draw = k;
-      break;
-    }
-    // Reject non-sensical answers.
-    if (k < 0 || k > n) {
-      continue;
-    }
-
-    // This deviates from Hormann's BRTS algorithm, as there is a log missing.
-    // For all (u, v) pairs outside of the bounding box, this calculates the
-    // transformed-reject ratio.
-    v = mcstate::math::log(v * alpha / (a / (us * us) + b));
-    real_type upperbound =
-      ((m + half) * mcstate::math::log((m + 1) / (r * (n - m + 1))) +
-       (n + one) * mcstate::math::log((n - m + 1) / (n - k + 1)) +
-       (k + half) * mcstate::math::log(r * (n - k + 1) / (k + 1)) +
-       stirling_approx_tail(m) + stirling_approx_tail(n - m) -
-       stirling_approx_tail(k) - stirling_approx_tail(n - k));
-    if (v <= upperbound) {
+    real_type k = std::floor(btrs_transform(x.a, x.b, x.c, u, us));
+    if (btrs_box(x.v_r, v, us) || btrs_accept(x, v, us, k)) {
       draw = k;
       break;
     }
@@ -295,5 +339,107 @@ real_type binomial(rng_state_type& rng_state, real_type n, real_type p) {
   return binomial_stochastic<real_type>(rng_state, std::round(n), p);
 }
 
+// Kernel for rejection_lanes(); the box test runs over all lanes
+// with the constants it needs held as arrays, and the full constants
+// are kept for the slow path.
+template <typename real_type_, size_t width_>
+class btrs_lanes_kernel {
+public:
+  using real_type = real_type_;
+  static constexpr size_t width = width_;
+
+  btrs_lanes_kernel() {
+    std::fill_n(a_, width, 0);
+    std::fill_n(b_, width, 1);
+    std::fill_n(c_, width, 0);
+    std::fill_n(v_r_, width, 0);
+    std::fill_n(q_, width, 0);
+    for (size_t l = 0; l < width; ++l) {
+      x_[l].n = 0;
+    }
+  }
+
+  // Only draws that binomial() would pass to btrs() use the kernel.
+  // The constants are kept from the lane's previous draw if the
+  // parameters have not changed, which is the common case
+  template <typename rng_state_type, typename Draws>
+  bool prepare(size_t l, rng_state_type& rng_state, Draws& draws,
+               size_t i, size_t j, real_type& value) {
+    const real_type n = draws.size(i, j);
+    const real_type p = draws.prob(i, j);
+    const real_type n_round = std::round(n);
+    const real_type q = p > static_cast<real_type>(0.5) ? 1 - p : p;
+    if (rng_state.deterministic || !(p > 0 && p < 1) || !(n_round * q >= 10)) {
+      value = binomial<real_type>(rng_state, n, p);
+      return false;
+    }
+    if (n_round != x_[l].n || q != q_[l]) {
+      x_[l] = btrs_setup(n_round, q);
+      q_[l] = q;
+    }
+    a_[l] = x_[l].a;
+    b_[l] = x_[l].b;
+    c_[l] = x_[l].c;
+    v_r_[l] = x_[l].v_r;
+    complement_[l] = p > static_cast<real_type>(0.5);
+    return true;
+  }
+
+  void candidates(const real_type * u, const real_type * v, real_type * us,
+                  real_type * k, real_type * box) const {
+    const real_type half = 0.5;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t l = 0; l < width; ++l) {
+      const real_type u_l = u[l] - half;
+      us[l] = half - mcstate::math::abs(u_l);
+      k[l] = lane_floor(btrs_transform(a_[l], b_[l], c_[l], u_l, us[l]));
+      box[l] = btrs_box(v_r_[l], v[l], us[l]) ? 1 : 0;
+    }
+  }
+
+  bool accept(size_t l, real_type v, real_type us, real_type k) const {
+    return btrs_accept(x_[l], v, us, k);
+  }
+
+  real_type finish(size_t l, real_type k) const {
+    return complement_[l] ? x_[l].n - k : k;
+  }
+
+private:
+  real_type a_[width];
+  real_type b_[width];
+  real_type c_[width];
+  real_type v_r_[width];
+  real_type q_[width];
+  btrs_constants<real_type> x_[width];
+  bool complement_[width];
+};
+
+/// Draw binomially distributed random numbers from several streams
+/// at once, running the rejection sampler (BTRS, used where `n * p`
+/// is at least 10) for `lane_width<real_type>()` streams in lockstep
+/// so that its fast path is vectorised; see `rejection_lanes()`. The
+/// draws from each stream are exactly those that `binomial()` would
+/// make.
+///
+/// @tparam real_type The underlying real number type
+///
+/// @param state Pointers to the random number state for each stream,
+///   which will be modified as a side effect
+///
+/// @param n_streams The number of streams
+///
+/// @param draws The draws to make (see `rejection_lanes()`), with
+///   `size(i, j)` and `prob(i, j)` giving the parameters of the `j`th
+///   draw from stream `i`
+template <typename real_type, typename rng_state_type, typename Draws>
+void binomial_lanes(rng_state_type * const * state, size_t n_streams,
+                    Draws& draws) {
+  using kernel = btrs_lanes_kernel<real_type, lane_width<real_type>()>;
+  rejection_lanes<kernel>(state, n_streams, draws);
+}
+
 }
 }
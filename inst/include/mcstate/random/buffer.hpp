@@ -0,0 +1,348 @@
+#pragma once
+
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "mcstate/random/generator.hpp"
+#include "mcstate/random/normal.hpp"
+#include "mcstate/random/prng.hpp"
+
+namespace mcstate {
+namespace random {
+
+/// A single worker thread that runs tasks in the order submitted;
+/// see `buffered_stream`.
+///
+/// A process forked from one holding a worker (e.g., by
+/// `parallel::mclapply`) inherits the object but not its thread, so
+/// callers must check `forked()` and do the work themselves if it is
+/// true; tasks submitted before the fork will never complete there.
+class background_worker {
+public:
+  background_worker() : stop_(false), pid_(process_id()),
+                        thread_(new std::thread([this] { run(); })) {
+  }
+
+  ~background_worker() {
+    if (forked()) {
+      // There is no thread to join in this process
+      thread_.release();
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_one();
+    thread_->join();
+  }
+
+  background_worker(const background_worker&) = delete;
+  background_worker& operator=(const background_worker&) = delete;
+
+  /// Queue a task, returning a future that is ready once it has run
+  std::future<void> submit(std::packaged_task<void()> task) {
+    auto ret = task.get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push(std::move(task));
+    }
+    cv_.notify_one();
+    return ret;
+  }
+
+  /// Test if we are running in a process forked from the one that
+  /// created the worker
+  bool forked() const {
+    return process_id() != pid_;
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::queue<std::packaged_task<void()>> tasks_;
+  bool stop_;
+  long pid_;
+  std::unique_ptr<std::thread> thread_;
+
+  static long process_id() {
+#ifdef _WIN32
+    return 0;
+#else
+    return static_cast<long>(getpid());
+#endif
+  }
+
+  // Runs until stopped, but only once all queued tasks are complete
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      auto task = std::move(tasks_.front());
+      tasks_.pop();
+      lock.unlock();
+      task();
+      lock.lock();
+    }
+  }
+};
+
+/// Serve single standard uniform or standard normal draws from a
+/// stream by generating them in blocks. This is useful where draws
+/// are requested one at a time by a caller for whom the per-call
+/// overhead dominates (e.g., from R).
+///
+/// The buffer holds raw uniforms only; a normal is built from the
+/// next uniforms in the buffer with the Box-Muller transform, using
+/// exactly the uniforms (and arithmetic) that `random_normal` would
+/// have used. Calls for uniform and normal draws can therefore be
+/// interleaved freely (as the samplers do at every step) without
+/// disturbing the buffer.
+///
+/// The buffer keeps a copy of the generator state at the start of
+/// each block, so that unconsumed draws can be discarded by
+/// `flush()`, which leaves the stream in exactly the state it would
+/// have been in had no draws been pre-generated. The sequence of
+/// numbers seen by the caller is therefore identical to drawing
+/// directly from the stream. Flushing replays the consumed part of
+/// the block, so it should be needed only before other sorts of
+/// draws, or to read the state.
+///
+/// If given a `background_worker`, then once a block has been
+/// consumed completely, as the next one is started the block after
+/// that is generated on the worker thread, so that it is ready by the
+/// time the current one is consumed. Only the worker touches the
+/// stream while a block is being generated; `flush()` waits for it
+/// and then resets the stream as above, so the numbers drawn and the
+/// final state are unchanged. The first block after a flush is not
+/// followed by a prefetch, so a caller that flushes more often than
+/// it uses up a block (e.g., a sampler whose model draws from the
+/// generator at every step) does not generate blocks only to discard
+/// them.
+///
+/// @tparam real_type The real type to return
+///
+/// @tparam rng_state_type The random number state type
+template <typename real_type, typename rng_state_type>
+class buffered_stream {
+public:
+  /// Construct a buffer
+  ///
+  /// @param state The stream to draw from; this must outlive the buffer
+  ///
+  /// @param size The number of uniforms to generate at once; if zero
+  ///   then draws are taken directly from the stream
+  ///
+  /// @param worker Optional worker thread used to generate the next
+  ///   block in the background; this must outlive the buffer
+  buffered_stream(rng_state_type& state, size_t size,
+                  background_worker * worker = nullptr) :
+    state_(&state), size_(size), pos_(0),
+    worker_(worker), has_pending_(false) {
+  }
+
+  /// Draw a standard uniform random number
+  real_type random_real() {
+    if (size_ == 0) {
+      return mcstate::random::random_real<real_type>(*state_);
+    }
+    return next();
+  }
+
+  /// Draw a standard normal random number, using the Box-Muller
+  /// method
+  real_type random_normal() {
+    if (size_ == 0) {
+      return mcstate::random::random_normal<real_type>(*state_);
+    }
+    // As for random_normal_box_muller
+    const real_type epsilon = utils::epsilon<real_type>();
+    real_type u1, u2;
+    do {
+      u1 = next();
+      u2 = next();
+    } while (u1 <= epsilon);
+    return box_muller(u1, u2);
+  }
+
+  /// Discard any unconsumed draws, returning the stream to the state
+  /// that it would have had without buffering. This must be called
+  /// before anything else draws from the stream.
+  void flush() {
+    discard_pending();
+    if (pos_ < data_.size()) {
+      *state_ = origin_;
+      for (size_t i = 0; i < pos_; ++i) {
+        mcstate::random::random_real<real_type>(*state_);
+      }
+    }
+    data_.clear();
+    pos_ = 0;
+  }
+
+  /// The number of uniforms generated at once
+  size_t size() const {
+    return size_;
+  }
+
+  /// The number of pre-generated uniforms not yet consumed
+  size_t available() const {
+    return data_.size() - pos_;
+  }
+
+  /// Whether the next block has been (or is being) generated in the
+  /// background
+  bool pending() const {
+    return has_pending_;
+  }
+
+private:
+  rng_state_type * state_;
+  rng_state_type origin_;
+  std::vector<real_type> data_;
+  size_t size_;
+  size_t pos_;
+
+  // The block being generated by the worker, which starts from
+  // pending_origin_ (the state at the end of the current block)
+  background_worker * worker_;
+  rng_state_type pending_origin_;
+  std::vector<real_type> pending_data_;
+  std::future<void> pending_;
+  bool has_pending_;
+
+  void fill(std::vector<real_type>& data) {
+    data.resize(size_);
+    for (auto& x : data) {
+      x = mcstate::random::random_real<real_type>(*state_);
+    }
+  }
+
+  void prefetch() {
+    if (worker_ == nullptr) {
+      return;
+    }
+    pending_origin_ = *state_;
+    has_pending_ = true;
+    if (worker_->forked()) {
+      fill(pending_data_);
+    } else {
+      pending_ = worker_->submit(std::packaged_task<void()>([this] {
+        fill(pending_data_);
+      }));
+    }
+  }
+
+  // In a forked process the worker may have been part way through the
+  // block, so generate it again here
+  void wait_pending() {
+    if (pending_.valid() && worker_->forked()) {
+      *state_ = pending_origin_;
+      fill(pending_data_);
+      pending_ = std::future<void>();
+    } else if (pending_.valid()) {
+      pending_.get();
+    }
+  }
+
+  void discard_pending() {
+    if (has_pending_) {
+      if (pending_.valid() && !worker_->forked()) {
+        pending_.get();
+      }
+      pending_ = std::future<void>();
+      *state_ = pending_origin_;
+      has_pending_ = false;
+    }
+  }
+
+  real_type next() {
+    if (pos_ == data_.size()) {
+      // Only prefetch once a whole block has been used since the last
+      // flush; otherwise the prefetched block is likely to be thrown
+      // away by the next flush
+      const bool consumed = !data_.empty();
+      if (has_pending_) {
+        wait_pending();
+        std::swap(data_, pending_data_);
+        origin_ = pending_origin_;
+        has_pending_ = false;
+      } else {
+        origin_ = *state_;
+        fill(data_);
+      }
+      pos_ = 0;
+      if (consumed) {
+        prefetch();
+      }
+    }
+    return data_[pos_++];
+  }
+};
+
+/// Buffers for every stream within a `prng` object; see
+/// `buffered_stream`.
+///
+/// @tparam real_type The real type to return
+///
+/// @tparam T The `prng` type
+template <typename real_type, typename T>
+class buffered_prng {
+public:
+  /// The buffer type used for each stream
+  using buffer_type = buffered_stream<real_type, typename T::rng_state>;
+
+  /// Construct buffers for all streams of `rng`, which must outlive
+  /// this object
+  ///
+  /// @param size The number of draws to generate at once per stream
+  ///
+  /// @param async Generate the next block for each stream on a
+  ///   background thread (see `buffered_stream`); one thread is
+  ///   shared by all streams
+  buffered_prng(T& rng, size_t size, bool async = false) :
+    worker_(async && size > 0 ? new background_worker() : nullptr) {
+    streams_.reserve(rng.size());
+    for (size_t i = 0; i < rng.size(); ++i) {
+      streams_.emplace_back(rng.state(i), size, worker_.get());
+    }
+  }
+
+  /// The number of streams
+  size_t size() const {
+    return streams_.size();
+  }
+
+  /// Return the buffer for the `i`th stream
+  buffer_type& stream(size_t i) {
+    return streams_[i];
+  }
+
+  /// Discard unconsumed draws from every stream
+  void flush() {
+    for (auto& s : streams_) {
+      s.flush();
+    }
+  }
+
+private:
+  std::vector<buffer_type> streams_;
+  // Declared after the streams so that it is destroyed (completing
+  // any queued blocks) first
+  std::unique_ptr<background_worker> worker_;
+};
+
+}
+}
@@ -32,10 +32,25 @@ using h2pe_sample_result = std::pair<real_type, real_type>;
 template <typename real_type>
 using h2pe_test_result = std::pair<bool, real_type>;
 
+// Constants used by H2PE that depend only on the parameters
+template <typename real_type>
+struct h2pe_constants {
+  real_type a;
+  real_type x_l;
+  real_type x_r;
+  real_type lambda_l;
+  real_type lambda_r;
+  real_type p1;
+  real_type p2;
+  real_type p3;
+};
+
 template <typename real_type, typename rng_state_type>
-real_type hypergeometric_hin(rng_state_type& rng_state, real_type n1, real_type n2, real_type n, real_type k);
+real_type hypergeometric_hin(rng_state_type& rng_state, real_type n1, real_type n2, real_type k, real_type p, real_type x);
+template <typename real_type>
+h2pe_constants<real_type> hypergeometric_h2pe_setup(real_type n1, real_type n2, real_type n, real_type k, real_type m);
 template <typename real_type, typename rng_state_type>
-real_type hypergeometric_h2pe(rng_state_type& rng_state, real_type n1, real_type n2, real_type n, real_type k, real_type m);
+real_type hypergeometric_h2pe(rng_state_type& rng_state, real_type n1, real_type n2, real_type k, real_type m, const h2pe_constants<real_type>& c);
 template <typename real_type, typename rng_state_type>
 h2pe_sample_result<real_type>
 h2pe_sample(rng_state_type& rng_state, real_type n1, real_type n2, real_type k,
@@ -55,19 +70,10 @@ template <typename T>
 T quad(T x);
 
 // Generate hypergeometric random number via inversion (HIN), p 130 of
-// reference.
+// reference. The starting point of the inversion (probability 'p' of
+// outcome 'x') is computed by the sampler setup.
 template <typename real_type, typename rng_state_type>
-real_type hypergeometric_hin(rng_state_type& rng_state, real_type n1, real_type n2, real_type n, real_type k) {
-  real_type p;
-  real_type x;
-  if (k < n2) {
-    p = fraction_of_products_of_factorials<real_type>(n2, n - k, n, n2 - k);
-    x = 0;
-  } else {
-    p = fraction_of_products_of_factorials<real_type>(n1, k, n, k - n2);
-    x = (k - n2);
-  }
-
+real_type hypergeometric_hin(rng_state_type& rng_state, real_type n1, real_type n2, real_type k, real_type p, real_type x) {
   real_type u = random_real<real_type>(rng_state);
   while (u > p && x < k) {
     // Comment in the Rust version:
@@ -79,8 +85,8 @@ real_type hypergeometric_hin(rng_state_type& rng_state, real_type n1, real_type
   return x;
 }
 
-template <typename real_type, typename rng_state_type>
-real_type hypergeometric_h2pe(rng_state_type& rng_state, real_type n1, real_type n2, real_type n, real_type k, real_type m) {
+template <typename real_type>
+h2pe_constants<real_type> hypergeometric_h2pe_setup(real_type n1, real_type n2, real_type n, real_type k, real_type m) {
   // Step 0 set up constants
   const real_type a = utils::lfactorial<real_type>(m) +
     utils::lfactorial<real_type>(n1 - m) +
@@ -123,16 +129,22 @@ real_type hypergeometric_h2pe(rng_state_type& rng_state, real_type n1, real_type
   const real_type p2 = p1 + k_l / lambda_l;
   const real_type p3 = p2 + k_r / lambda_r;
 
+  return h2pe_constants<real_type>{a, x_l, x_r, lambda_l, lambda_r,
+                                   p1, p2, p3};
+}
+
+template <typename real_type, typename rng_state_type>
+real_type hypergeometric_h2pe(rng_state_type& rng_state, real_type n1, real_type n2, real_type k, real_type m, const h2pe_constants<real_type>& c) {
   real_type x; // final result
   for (;;) {
-    const auto vy = h2pe_sample(rng_state, n1, n2, k, p1, p2, p3,
-                                x_l, x_r, lambda_l, lambda_r);
+    const auto vy = h2pe_sample(rng_state, n1, n2, k, c.p1, c.p2, c.p3,
+                                c.x_l, c.x_r, c.lambda_l, c.lambda_r);
     const real_type v = vy.first;
     const real_type y = vy.second;
 
     const auto result = (m < 100 || y <= 50) ?
       h2pe_test_recursive(n1, n2, k, m, y, v) :
-      h2pe_test_squeeze(n1, n2, k, m, y, v, a);
+      h2pe_test_squeeze(n1, n2, k, m, y, v, c.a);
     if (result.first) {
       x = result.second;
       break;
@@ -276,41 +288,163 @@ T quad(T x) {
 
 }
 
-// NOTE: we return a real, not an int, as with deterministic mode this
-// will not necessarily be an integer
-template <typename real_type, typename rng_state_type>
-real_type hypergeometric_stochastic(rng_state_type& rng_state, real_type n1, real_type n2, real_type k) {
-  const real_type n = n1 + n2;
-  hypergeometric_validate(n1, n2, n, k);
-
-  real_type sign_x = 1;
-  real_type offset_x = 0;
-
-  if (n1 > n2) {
-    sign_x = -1;
-    offset_x = k;
-    std::swap(n1, n2);
+/// Draw from the hypergeometric distribution with fixed parameters.
+/// All the setup that depends only on the parameters (the
+/// transformation to the canonical parameterisation, the choice of
+/// algorithm and its constants) is done once on construction, so this
+/// is much cheaper than calling `hypergeometric()` repeatedly where
+/// many draws are needed with the same parameters.
+///
+/// The draws are identical to those from `hypergeometric()`.
+///
+/// @tparam real_type The underlying real number type, typically
+/// `double` or `float`.
+template <typename real_type>
+class hypergeometric_sampler {
+public:
+  /// Construct a sampler
+  ///
+  /// @param n1 The number of white balls in the urn
+  ///
+  /// @param n2 The number of black balls in the urn
+  ///
+  /// @param k The number of draws
+  hypergeometric_sampler(real_type n1, real_type n2, real_type k) :
+    mean_(n1 * k / (n1 + n2)), m_(0), hin_p_(0), hin_x_(0), h2pe_() {
+    static_assert(std::is_floating_point<real_type>::value,
+                  "Only valid for floating-point types");
+    // See hypergeometric() for why we round here
+    n1 = std::round(n1);
+    n2 = std::round(n2);
+    k = std::round(k);
+    const real_type n = n1 + n2;
+    hypergeometric_validate(n1, n2, n, k);
+
+    sign_x_ = 1;
+    offset_x_ = 0;
+    if (n1 > n2) {
+      sign_x_ = -1;
+      offset_x_ = k;
+      std::swap(n1, n2);
+    }
+    if (k > n / 2) {
+      offset_x_ += n1 * sign_x_;
+      sign_x_ = -sign_x_;
+      k = n - k;
+    }
+    n1_ = n1;
+    n2_ = n2;
+    k_ = k;
+
+    // Same fast exits as for the binomial case, n == k case handled by
+    // the transformation above.
+    if (k == 0 || n1 == 0) {
+      algorithm_ = algorithm::none;
+    } else {
+      constexpr real_type hin_threshold = 10;
+      m_ = std::floor((k + 1) * (n1 + 1) / (real_type)(n + 2));
+      if (m_ < hin_threshold) {
+        algorithm_ = algorithm::hin;
+        if (k < n2) {
+          hin_p_ = fraction_of_products_of_factorials<real_type>(n2, n - k, n, n2 - k);
+          hin_x_ = 0;
+        } else {
+          hin_p_ = fraction_of_products_of_factorials<real_type>(n1, k, n, k - n2);
+          hin_x_ = (k - n2);
+        }
+      } else {
+        algorithm_ = algorithm::h2pe;
+        h2pe_ = hypergeometric_h2pe_setup<real_type>(n1, n2, n, k, m_);
+      }
+    }
   }
-  if (k > n / 2) {
-    offset_x += n1 * sign_x;
-    sign_x = -sign_x;
-    k = n - k;
+
+  /// Draw a single number
+  ///
+  /// @param rng_state Reference to the random number state, will be
+  /// modified as a side-effect
+  // NOTE: we return a real, not an int, as with deterministic mode this
+  // will not necessarily be an integer
+  template <typename rng_state_type>
+  real_type operator()(rng_state_type& rng_state) const {
+    if (rng_state.deterministic) {
+      return mean_;
+    }
+    real_type x;
+    switch (algorithm_) {
+    case algorithm::hin:
+      x = hypergeometric_hin<real_type>(rng_state, n1_, n2_, k_,
+                                        hin_p_, hin_x_);
+      break;
+    case algorithm::h2pe:
+      x = hypergeometric_h2pe<real_type>(rng_state, n1_, n2_, k_, m_, h2pe_);
+      break;
+    case algorithm::none:
+    default:
+      x = 0;
+    }
+    return offset_x_ + sign_x_ * x;
   }
 
-  real_type x;
-  // Same fast exits as for the binomial case, n == k case handled by
-  // the transformation above.
-  if (k == 0 || n1 == 0) {
-    x = 0;
-  } else {
-    constexpr real_type hin_threshold = 10;
-    const real_type m = std::floor((k + 1) * (n1 + 1) / (real_type)(n + 2));
-    x = (m < hin_threshold) ?
-      hypergeometric_hin<real_type>(rng_state, n1, n2, n, k) :
-      hypergeometric_h2pe<real_type>(rng_state, n1, n2, n, k, m);
+  /// Draw `n` numbers into `dest`, choosing the algorithm once for
+  /// the whole batch
+  ///
+  /// @tparam T The type written to `dest`, which need not be
+  /// `real_type` (e.g., `double` when called from R with single
+  /// precision generators)
+  ///
+  /// @param rng_state Reference to the random number state, will be
+  /// modified as a side-effect
+  ///
+  /// @param dest Destination, with space for `n` values
+  ///
+  /// @param n The number of draws
+  template <typename rng_state_type, typename T>
+  void operator()(rng_state_type& rng_state, T * dest, size_t n) const {
+    if (rng_state.deterministic) {
+      std::fill_n(dest, n, mean_);
+      return;
+    }
+    switch (algorithm_) {
+    case algorithm::hin:
+      for (size_t i = 0; i < n; ++i) {
+        dest[i] = offset_x_ + sign_x_ *
+          hypergeometric_hin<real_type>(rng_state, n1_, n2_, k_,
+                                        hin_p_, hin_x_);
+      }
+      break;
+    case algorithm::h2pe:
+      for (size_t i = 0; i < n; ++i) {
+        dest[i] = offset_x_ + sign_x_ *
+          hypergeometric_h2pe<real_type>(rng_state, n1_, n2_, k_, m_, h2pe_);
+      }
+      break;
+    case algorithm::none:
+    default:
+      std::fill_n(dest, n, offset_x_);
+    }
   }
 
-  return offset_x + sign_x * x;
+private:
+  enum class algorithm {none, hin, h2pe};
+  real_type mean_;
+  real_type n1_;
+  real_type n2_;
+  real_type k_;
+  real_type sign_x_;
+  real_type offset_x_;
+  algorithm algorithm_;
+  real_type m_;
+  real_type hin_p_;
+  real_type hin_x_;
+  h2pe_constants<real_type> h2pe_;
+};
+
+// NOTE: we return a real, not an int, as with deterministic mode this
+// will not necessarily be an integer
+template <typename real_type, typename rng_state_type>
+real_type hypergeometric_stochastic(rng_state_type& rng_state, real_type n1, real_type n2, real_type k) {
+  return hypergeometric_sampler<real_type>(n1, n2, k)(rng_state);
 }
 
 template <typename real_type>
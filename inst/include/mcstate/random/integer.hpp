@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "mcstate/random/generator.hpp"
+
+namespace mcstate {
+namespace random {
+
+namespace {
+
+// Full width product of two unsigned integers, returning the high
+// half and setting 'lo' to the low half
+__host__ __device__
+inline uint32_t mul_wide(uint32_t a, uint32_t b, uint32_t& lo) {
+  const uint64_t m = static_cast<uint64_t>(a) * b;
+  lo = static_cast<uint32_t>(m);
+  return static_cast<uint32_t>(m >> 32);
+}
+
+__host__ __device__
+inline uint64_t mul_wide(uint64_t a, uint64_t b, uint64_t& lo) {
+#if defined(__CUDA_ARCH__)
+  lo = a * b;
+  return __umul64hi(a, b);
+#elif defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 uint128_t;
+  const uint128_t m = static_cast<uint128_t>(a) * b;
+  lo = static_cast<uint64_t>(m);
+  return static_cast<uint64_t>(m >> 64);
+#else
+  const uint64_t a_lo = a & 0xffffffff, a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xffffffff, b_hi = b >> 32;
+  const uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi;
+  const uint64_t hl = a_hi * b_lo, hh = a_hi * b_hi;
+  const uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+  lo = (mid << 32) | (ll & 0xffffffff);
+  return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+}
+
+/// Draw an integer uniformly on `[0, n)` without bias, using
+/// Lemire's "nearly divisionless" method
+/// (https://arxiv.org/abs/1805.10941). This uses the high bits of the
+/// product of a random integer and `n`, rejecting the small number of
+/// products that would otherwise over-represent some values. A
+/// division is only needed in the rare case where rejection is
+/// possible, and on average fewer than one extra draw is needed.
+///
+/// Unlike taking the result modulo `n`, or scaling a random real
+/// number, this is exactly uniform for every `n`, and because the
+/// result comes from the high bits it is unaffected by the weaker
+/// low bits of the "+" scramblers.
+///
+/// @tparam rng_state_type The random number state type
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param n The number of possible values; must be at least 1
+__nv_exec_check_disable__
+template <typename rng_state_type>
+__host__ __device__
+typename rng_state_type::int_type
+random_integer(rng_state_type& rng_state,
+               typename rng_state_type::int_type n) {
+  using int_type = typename rng_state_type::int_type;
+  int_type lo;
+  int_type hi = mul_wide(next(rng_state), n, lo);
+  if (lo < n) {
+    const int_type threshold = static_cast<int_type>(0 - n) % n;
+    while (lo < threshold) {
+      hi = mul_wide(next(rng_state), n, lo);
+    }
+  }
+  return hi;
+}
+
+/// Shuffle the first `n` elements of `x` in place, so that every
+/// permutation is equally likely (Fisher-Yates, in Durstenfeld's
+/// form), using `n - 1` bounded integer draws.
+///
+/// @tparam T The type of the container; anything supporting random
+/// access
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param x The container to shuffle
+///
+/// @param n The number of elements of `x` to shuffle
+__nv_exec_check_disable__
+template <typename rng_state_type, typename T>
+__host__ __device__
+void shuffle(rng_state_type& rng_state, T& x, size_t n) {
+  using int_type = typename rng_state_type::int_type;
+  for (size_t i = n; i > 1; --i) {
+    const size_t j = random_integer(rng_state, static_cast<int_type>(i));
+    const auto tmp = x[i - 1];
+    x[i - 1] = x[j];
+    x[j] = tmp;
+  }
+}
+
+/// Draw a random permutation of `0, ..., n - 1`
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param n The number of elements
+///
+/// @param ret Container for the permutation, of length `n`
+__nv_exec_check_disable__
+template <typename rng_state_type, typename T>
+__host__ __device__
+void permutation(rng_state_type& rng_state, size_t n, T& ret) {
+  for (size_t i = 0; i < n; ++i) {
+    ret[i] = i;
+  }
+  shuffle(rng_state, ret, n);
+}
+
+/// Determine whether `sample_without_replacement` needs scratch
+/// space to sample `k` from `n` elements. When `k` is small compared
+/// with `n` we use Floyd's algorithm, which needs no extra space but
+/// costs `O(k^2)`; otherwise we use a partial shuffle of all `n`
+/// elements, which costs `O(n)`.
+__host__ __device__
+inline bool sample_without_replacement_uses_work(size_t n, size_t k) {
+  return k > 16 && k * k > n;
+}
+
+/// Sample `k` distinct elements from `0, ..., n - 1`, in random
+/// order, so that each of the `n! / (n - k)!` possible outcomes is
+/// equally likely.
+///
+/// @tparam T,U The type of the containers for `ret` and `work`
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param n The number of elements to sample from
+///
+/// @param k The number of elements to sample; at most `n`
+///
+/// @param ret Container for the sample, of length `k`
+///
+/// @param work Scratch space of length `n`; this is only used where
+/// `sample_without_replacement_uses_work(n, k)` is true, and can be
+/// empty otherwise
+__nv_exec_check_disable__
+template <typename rng_state_type, typename T, typename U>
+__host__ __device__
+void sample_without_replacement(rng_state_type& rng_state, size_t n,
+                                size_t k, T& ret, U& work) {
+  using int_type = typename rng_state_type::int_type;
+  if (sample_without_replacement_uses_work(n, k)) {
+    for (size_t i = 0; i < n; ++i) {
+      work[i] = i;
+    }
+    for (size_t i = 0; i < k; ++i) {
+      const size_t j = i + random_integer(rng_state,
+                                          static_cast<int_type>(n - i));
+      const auto tmp = work[i];
+      work[i] = work[j];
+      work[j] = tmp;
+      ret[i] = work[i];
+    }
+  } else {
+    // Floyd's algorithm gives a uniformly chosen subset, which we
+    // then put into a random order.
+    for (size_t i = 0, j = n - k; i < k; ++i, ++j) {
+      const size_t t = random_integer(rng_state, static_cast<int_type>(j + 1));
+      bool found = false;
+      for (size_t m = 0; m < i; ++m) {
+        if (static_cast<size_t>(ret[m]) == t) {
+          found = true;
+          break;
+        }
+      }
+      ret[i] = found ? j : t;
+    }
+    shuffle(rng_state, ret, k);
+  }
+}
+
+}
+}
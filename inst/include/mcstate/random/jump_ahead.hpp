@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "mcstate/random/generator.hpp"
+
+namespace mcstate {
+namespace random {
+
+/// Jump a generator forward by `2^k` steps, for any `k`. The fixed
+/// jumps in `jump()` and `long_jump()` use precomputed polynomials
+/// for just two distances; here we compute the jump for any power of
+/// two.
+///
+/// The state update of every generator here is linear over GF(2), so
+/// advancing by `d` steps is multiplication of the state (as a vector
+/// of bits) by the `d`th power of the transition matrix. We find the
+/// transition matrix by advancing each unit vector by one step, then
+/// square it `k` times. For the 256 bit generators and `k = 64` this
+/// takes a few milliseconds, so objects of this class should be
+/// constructed once and reused; applying the jump is cheap (one
+/// matrix-vector product).
+///
+/// @tparam T The random number generator state type
+template <typename T>
+class jump_ahead {
+public:
+  /// The underlying integer type
+  using int_type = typename T::int_type;
+
+  /// Construct the jump
+  ///
+  /// @param k The jump will be `2^k` steps
+  explicit jump_ahead(int k) : columns_(n_bits) {
+    for (size_t j = 0; j < n_bits; ++j) {
+      T s;
+      for (size_t i = 0; i < n_words; ++i) {
+        s[i] = 0;
+      }
+      s[j / word_bits] = static_cast<int_type>(1) << (j % word_bits);
+      next(s);
+      std::copy_n(s.state, n_words, columns_[j].begin());
+    }
+    for (int i = 0; i < k; ++i) {
+      square();
+    }
+  }
+
+  /// Double the length of the jump
+  void square() {
+    std::vector<word_vector> squared(n_bits);
+    for (size_t j = 0; j < n_bits; ++j) {
+      squared[j] = multiply(columns_[j].data());
+    }
+    columns_ = std::move(squared);
+  }
+
+  /// Apply the jump
+  ///
+  /// @param state The random number state, will be updated as a side effect
+  void operator()(T& state) const {
+    const auto result = multiply(state.state);
+    std::copy_n(result.begin(), n_words, state.state);
+  }
+
+private:
+  static constexpr size_t n_words = T::size();
+  static constexpr size_t word_bits = bit_size<int_type>();
+  static constexpr size_t n_bits = n_words * word_bits;
+  using word_vector = std::array<int_type, n_words>;
+
+  // Column j of the matrix is the image of the j'th unit vector
+  std::vector<word_vector> columns_;
+
+  word_vector multiply(const int_type * x) const {
+    word_vector ret{};
+    for (size_t i = 0; i < n_words; ++i) {
+      for (size_t b = 0; b < word_bits; ++b) {
+        if ((x[i] >> b) & 1) {
+          const auto& col = columns_[i * word_bits + b];
+          for (size_t m = 0; m < n_words; ++m) {
+            ret[m] ^= col[m];
+          }
+        }
+      }
+    }
+    return ret;
+  }
+};
+
+/// The base-2 log of the length of a substream, which divides the
+/// space between the streams created by `jump()` into (at least)
+/// 2^32 pieces; 2^32 steps for the 128 bit generators and 2^64 for
+/// the larger ones.
+template <typename T>
+constexpr int substream_log2() {
+  return T::size() * bit_size<typename T::int_type>() / 4 < 64 ?
+    T::size() * bit_size<typename T::int_type>() / 4 : 64;
+}
+
+/// Jump the random number state forward by the length of one
+/// substream (see `substream_log2()`). This is used to split the
+/// draws from a single stream into independent blocks.
+///
+/// @param state The random number state, will be updated as a side effect
+template <typename T>
+void substream_jump(T& state) {
+  static const jump_ahead<T> jump(substream_log2<T>());
+  jump(state);
+}
+
+/// The number of substreams that `substream_jump(state, n)` can jump
+/// over is less than `2^substream_jump_levels`
+constexpr size_t substream_jump_levels = 32;
+
+/// Jump the random number state forward by `n` substreams, with one
+/// precomputed jump per bit of `n` (so at most
+/// `substream_jump_levels` matrix-vector products) rather than `n`
+/// single jumps; this gives random access to the substreams. The
+/// first call builds the jumps, which takes a few tens of
+/// milliseconds.
+///
+/// @param state The random number state, will be updated as a side effect
+///
+/// @param n The number of substreams to jump over; must be less than
+///   `2^substream_jump_levels`
+template <typename T>
+void substream_jump(T& state, size_t n) {
+  static const std::vector<jump_ahead<T>> jumps = [] {
+    std::vector<jump_ahead<T>> ret;
+    ret.reserve(substream_jump_levels);
+    ret.emplace_back(substream_log2<T>());
+    for (size_t i = 1; i < substream_jump_levels; ++i) {
+      ret.push_back(ret.back());
+      ret.back().square();
+    }
+    return ret;
+  }();
+  for (size_t i = 0; n > 0; ++i, n >>= 1) {
+    if (n & 1) {
+      jumps[i](state);
+    }
+  }
+}
+
+}
+}
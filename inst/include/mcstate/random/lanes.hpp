@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+
+#include "mcstate/random/generator.hpp"
+#include "mcstate/random/math.hpp"
+
+namespace mcstate {
+namespace random {
+
+/// The number of lanes run together by the lane-parallel rejection
+/// samplers (see `binomial_lanes()` and `poisson_lanes()`); this is
+/// the number of values of `real_type` in a 256 bit vector, so 4 for
+/// double and 8 for float.
+template <typename real_type>
+constexpr size_t lane_width() {
+  return 32 / sizeof(real_type);
+}
+
+namespace {
+
+template <typename real_type>
+struct lane_bits;
+
+template <>
+struct lane_bits<double> {
+  using type = uint64_t;
+};
+
+template <>
+struct lane_bits<float> {
+  using type = uint32_t;
+};
+
+template <typename real_type>
+inline typename lane_bits<real_type>::type lane_to_bits(real_type x) {
+  typename lane_bits<real_type>::type u;
+  std::memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+template <typename real_type>
+inline real_type lane_from_bits(typename lane_bits<real_type>::type u) {
+  real_type x;
+  std::memcpy(&x, &u, sizeof(x));
+  return x;
+}
+
+}
+
+/// Exactly `std::floor(x)`, for all x, but written so that a loop over
+/// it can be vectorised. With the default floating point flags gcc
+/// will not vectorise `std::floor` itself, nor if-convert a
+/// conditional floating point subtraction, so the result is built by
+/// rounding (adding and subtracting 2^52, or 2^23 for float, with the
+/// sign of x), and the corrections are applied by masking bits.
+///
+/// The rounding relies on strict IEEE semantics, as do the lane
+/// kernels that use this: with `-ffast-math` the compiler may fold
+/// `(x + shift) - shift` to `x`. When compiled that way (detected by
+/// `__FAST_MATH__`) this falls back on `std::floor`, which is correct
+/// but will not vectorise.
+template <typename real_type>
+inline real_type lane_floor(real_type x) {
+#if defined(__FAST_MATH__)
+  return std::floor(x);
+#else
+  using bits = typename lane_bits<real_type>::type;
+  constexpr bits sign = static_cast<bits>(1) << (8 * sizeof(bits) - 1);
+  // At and above this every value is an integer
+  constexpr real_type big = 1 / std::numeric_limits<real_type>::epsilon();
+  const bits x_bits = lane_to_bits(x);
+  const bits x_sign = x_bits & sign;
+  const real_type shift = lane_from_bits<real_type>(lane_to_bits(big) | x_sign);
+  const real_type r = (x + shift) - shift;
+  // Subtract one where rounding went up
+  const bits down = -static_cast<bits>(r > x);
+  const real_type f =
+    r - lane_from_bits<real_type>(lane_to_bits<real_type>(1) & down);
+  // Restore the sign of zero, and pass through large and non-finite x
+  const bits keep = -static_cast<bits>(mcstate::math::abs(x) < big);
+  return lane_from_bits<real_type>(((lane_to_bits(f) | x_sign) & keep) |
+                                   (x_bits & ~keep));
+#endif
+}
+
+/// Run a transformed-rejection sampler on several streams in
+/// lockstep. Each lane makes a series of draws from its own stream;
+/// on every iteration each lane that is still running draws its pair
+/// of uniforms, the candidates and the box test are computed for all
+/// lanes together in a loop the compiler can vectorise, and only the
+/// lanes that fall outside the box take the scalar slow path. A lane
+/// that accepts moves straight on to its next draw, so lanes do not
+/// wait for each other. Because each lane uses its own stream in
+/// order, and the kernel shares its arithmetic with the scalar
+/// sampler, the draws are identical to making them one at a time.
+///
+/// The kernel provides `prepare()`, which either makes a draw
+/// directly (for parameters that the scalar sampler would not give
+/// to the rejection algorithm, or in deterministic mode), returning
+/// `false`, or stores the constants for the lane and returns `true`;
+/// `candidates()`, the vectorised step; `accept()`, the slow path for
+/// one lane; and `finish()`, which converts an accepted candidate to
+/// the returned value.
+///
+/// The draws object provides `len(i)`, the number of draws to make
+/// from stream `i`; the parameter accessors needed by the kernel;
+/// `set(i, j, value)`, called with the `j`th draw from stream `i`; and
+/// `error(i, e)`, called if the `j`th draw of stream `i` throws, after
+/// which no more draws are made from that stream.
+///
+/// @tparam Kernel The sampler kernel
+///
+/// @param state Pointers to the random number state for each lane,
+///   which will be modified as a side effect
+///
+/// @param n_lanes The number of lanes; these are run `Kernel::width`
+///   at a time
+///
+/// @param draws The draws object
+template <typename Kernel, typename rng_state_type, typename Draws>
+void rejection_lanes(rng_state_type * const * state, size_t n_lanes,
+                     Draws& draws) {
+  using real_type = typename Kernel::real_type;
+  constexpr size_t width = Kernel::width;
+  for (size_t from = 0; from < n_lanes; from += width) {
+    const size_t n = std::min(width, n_lanes - from);
+    Kernel kernel;
+    size_t j[width], len[width];
+    bool active[width];
+    // Lanes that are not running still go through the vectorised
+    // step, so these need to hold harmless values. The box test
+    // result is held as a real (1 or 0) rather than a bool so that it
+    // can be stored from a vector register.
+    real_type u[width], v[width], us[width], k[width], box[width];
+    std::fill_n(u, width, static_cast<real_type>(0.5));
+    std::fill_n(v, width, static_cast<real_type>(0.5));
+
+    // Move lane l on to its next draw that needs the kernel, making
+    // any others on the way directly
+    auto next = [&](size_t l) {
+      const size_t i = from + l;
+      try {
+        for (; j[l] < len[l]; ++j[l]) {
+          real_type value;
+          if (kernel.prepare(l, *state[i], draws, i, j[l], value)) {
+            return true;
+          }
+          draws.set(i, j[l], value);
+        }
+      } catch (std::exception const& e) {
+        draws.error(i, e);
+      }
+      return false;
+    };
+
+    size_t n_active = 0;
+    for (size_t l = 0; l < n; ++l) {
+      j[l] = 0;
+      len[l] = draws.len(from + l);
+      active[l] = next(l);
+      n_active += active[l];
+    }
+    std::fill(active + n, active + width, false);
+
+    while (n_active > 0) {
+      for (size_t l = 0; l < n; ++l) {
+        if (active[l]) {
+          u[l] = random_real<real_type>(*state[from + l]);
+          v[l] = random_real<real_type>(*state[from + l]);
+        }
+      }
+      kernel.candidates(u, v, us, k, box);
+      for (size_t l = 0; l < n; ++l) {
+        if (active[l] && (box[l] != 0 || kernel.accept(l, v[l], us[l], k[l]))) {
+          draws.set(from + l, j[l], kernel.finish(l, k[l]));
+          ++j[l];
+          active[l] = next(l);
+          n_active -= !active[l];
+        }
+      }
+    }
+  }
+}
+
+}
+}
@@ -389,6 +389,29 @@ inline float abs(float x) {
 }
 #endif
 
+// Special because it has two outputs; compilers will typically fuse
+// the separate calls on the host, and CUDA provides this directly
+template <typename T>
+__host__ __device__
+void sincos(T x, T& s, T& c) {
+  s = std::sin(x);
+  c = std::cos(x);
+}
+
+#ifdef __CUDA_ARCH__
+template <>
+__device__
+inline void sincos(float x, float& s, float& c) {
+  ::sincosf(x, &s, &c);
+}
+
+template <>
+__device__
+inline void sincos(double x, double& s, double& c) {
+  ::sincos(x, &s, &c);
+}
+#endif
+
 template <typename T>
 __host__ __device__
 T min(T a, T b) {
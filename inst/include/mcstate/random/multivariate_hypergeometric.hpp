@@ -0,0 +1,136 @@
+#pragma once
+
+#include <vector>
+
+#include "mcstate/random/generator.hpp"
+#include "mcstate/random/hypergeometric.hpp"
+#include "mcstate/random/numeric.hpp"
+
+namespace mcstate {
+namespace random {
+
+/// Compute the order in which categories are visited by
+/// `multivariate_hypergeometric`; this is the categories sorted by
+/// decreasing size (ties broken by position). Drawing the largest
+/// categories first means that the number of remaining draws falls
+/// quickly, so that later (small) categories are usually resolved
+/// without drawing at all.
+///
+/// This is a simple insertion sort as the number of categories is
+/// typically small, and it needs no additional storage.
+///
+/// @tparam T,V The type of the containers for `n` and `order`
+///
+/// @param n The number of balls of each colour
+///
+/// @param len The number of categories
+///
+/// @param order Container for the order, of length `len`
+template <typename T, typename V>
+__host__ __device__
+void multivariate_hypergeometric_order(const T& n, int len, V& order) {
+  for (int i = 0; i < len; ++i) {
+    int j = i;
+    while (j > 0 && n[order[j - 1]] < n[i]) {
+      order[j] = order[j - 1];
+      --j;
+    }
+    order[j] = i;
+  }
+}
+
+/// Draw one sample from the multivariate hypergeometric
+/// distribution; this is the generalisation of `hypergeometric` to
+/// an urn with balls of `len` different colours, and the outcome is
+/// the number of balls of each colour retrieved.
+///
+/// This is sampled as a chain of univariate hypergeometric draws,
+/// conditional on the draws made so far, in the same way as
+/// `multinomial` is a chain of binomial draws. Categories are
+/// visited in the order given by `order` (see
+/// `multivariate_hypergeometric_order`) and the chain stops as soon
+/// as all `k` balls have been accounted for.
+///
+/// As with `multinomial`, `n`, `order` and `ret` may be any
+/// containers supporting random access.
+///
+/// @tparam real_type The underlying real number type, typically
+/// `double` or `float`.
+///
+/// @tparam rng_state_type The random number state type
+///
+/// @tparam T,U,V The type of the containers for `n`, `ret` and `order`
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param k The number of balls to draw
+///
+/// @param n The number of balls of each colour; these must be
+/// non-negative and sum to at least `k`
+///
+/// @param len The number of colours
+///
+/// @param order The order to visit categories in; a permutation of
+/// `0, ..., len - 1`
+///
+/// @param ret Container for the return value
+template <typename real_type, typename rng_state_type,
+          typename T, typename U, typename V>
+__host__ __device__
+void multivariate_hypergeometric(rng_state_type& rng_state, real_type k,
+                                 const T& n, int len, const V& order,
+                                 U& ret) {
+  real_type n_tot = 0;
+  for (int i = 0; i < len; ++i) {
+    if (n[i] < 0) {
+      mcstate::utils::fatal_error("Invalid call to multivariate_hypergeometric with n < 0");
+    }
+    n_tot += n[i];
+  }
+  if (k < 0 || k > n_tot) {
+    mcstate::utils::fatal_error("Invalid call to multivariate_hypergeometric with k outside [0, sum(n)]");
+  }
+
+  for (int i = 0; i < len - 1; ++i) {
+    const int idx = order[i];
+    const real_type n_i = n[idx];
+    n_tot -= n_i;
+    if (k == 0 || n_i == 0) {
+      ret[idx] = 0;
+    } else if (n_tot == 0) {
+      ret[idx] = k;
+    } else {
+      ret[idx] = hypergeometric<real_type>(rng_state, n_i, n_tot, k);
+    }
+    k -= ret[idx];
+  }
+  if (len > 0) {
+    ret[order[len - 1]] = k;
+  }
+}
+
+// These ones are designed for us within standalone programs and won't
+// actually be tested by default which is not great.
+template <typename real_type, typename rng_state_type>
+void multivariate_hypergeometric(rng_state_type& rng_state,
+                                 real_type k,
+                                 const std::vector<real_type>& n,
+                                 std::vector<real_type>& ret) {
+  std::vector<int> order(n.size());
+  multivariate_hypergeometric_order(n, n.size(), order);
+  multivariate_hypergeometric<real_type>(rng_state, k, n, n.size(), order,
+                                         ret);
+}
+
+template <typename real_type, typename rng_state_type>
+std::vector<real_type> multivariate_hypergeometric(rng_state_type& rng_state,
+                                                   real_type k,
+                                                   const std::vector<real_type>& n) {
+  std::vector<real_type> ret(n.size());
+  multivariate_hypergeometric(rng_state, k, n, ret);
+  return ret;
+}
+
+}
+}
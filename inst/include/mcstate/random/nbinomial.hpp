@@ -5,6 +5,8 @@
 #include "mcstate/random/gamma.hpp"
 #include "mcstate/random/poisson.hpp"
 #include "mcstate/random/generator.hpp"
+#include "mcstate/random/math.hpp"
+#include "mcstate/random/numeric.hpp"
 
 namespace mcstate {
 namespace random {
@@ -22,21 +24,128 @@ void nbinomial_validate(real_type size, real_type prob) {
   }
 }
 
+template <typename real_type>
+void nbinomial_mu_validate(real_type size, real_type mu) {
+  if (!std::isfinite(size) || !std::isfinite(mu) || size <= 0 || mu < 0) {
+    char buffer[256];
+    snprintf(buffer, 256,
+             "Invalid call to nbinomial with size = %g, mu = %g",
+             size, mu);
+    mcstate::utils::fatal_error(buffer);
+  }
+}
+
+// Below this mean we sample by inversion; above it the gamma-Poisson
+// mixture is cheaper. Inversion costs one step per unit of the mean,
+// while the mixture costs about the same at any mean. Timed with
+// inst/random/nbinomial (gcc 12.2, -O2, x86-64), the mixture becomes
+// faster at a mean of 40 to 80 depending on size: about 40 for size
+// 1, 60 for size 20 and up, and 80 for size 0.5. The one exception
+// was single precision with size 1, where the two broke even at 30.
+// We switch at the bottom of this range, so that inversion is not
+// used where it is slower; at a mean of 30 it is up to twice as fast,
+// and 2.5 to 5 times faster below 10.
+template <typename real_type>
+constexpr real_type nbinomial_inversion_max_mean() {
+  return 30;
+}
+
+}
+
+/// Draw from the negative binomial distribution by sequential search
+/// of the cumulative distribution function, using a single uniform
+/// random number. The expected number of iterations is one more than
+/// the mean, so this is only efficient for small means.
+///
+/// @param size The target number of successful trials
+///
+/// @param p0 The probability of zero failures, `prob^size`
+///
+/// @param q The probability of failure on each trial, `1 - prob`
+template <typename real_type, typename rng_state_type>
+real_type nbinomial_inversion(rng_state_type& rng_state, real_type size,
+                              real_type p0, real_type q) {
+  const real_type u = random_real<real_type>(rng_state);
+  const real_type mean = size * q / (1 - q);
+  real_type p = p0;
+  real_type cdf = p0;
+  real_type x = 0;
+  while (u > cdf) {
+    p *= q * (x + size) / (x + 1);
+    cdf += p;
+    x++;
+    // Rounding error in the cdf could leave it just short of a
+    // uniform very close to 1; stop once past the mode and the
+    // remaining terms can no longer change it.
+    if (x > mean && p < cdf * utils::epsilon<real_type>()) {
+      break;
+    }
+  }
+  return x;
 }
 
+/// Draw random number from the negative binomial distribution,
+/// parameterised by the target number of successful trials and the
+/// probability of success of each trial; the outcome is the number of
+/// failures before `size` successes.
+///
+/// Small means are sampled by inversion, larger ones as a Poisson
+/// draw with a gamma distributed rate.
+///
+/// @param size The target number of successful trials
+///
+/// @param prob The probability of success on each trial
 template <typename real_type, typename rng_state_type>
 real_type nbinomial(rng_state_type& rng_state, real_type size, real_type prob) {
 #ifdef __CUDA_ARCH__
   static_assert("nbinomial() not implemented for GPU targets");
 #endif
-    nbinomial_validate(size, prob);
+  nbinomial_validate(size, prob);
 
-    if (rng_state.deterministic) {
-      return (1 - prob) * size / prob;
-    }
-    return (prob == 1) ? 0 : poisson(rng_state, gamma(rng_state, size, (1 - prob) / prob));
+  const real_type q = 1 - prob;
+  if (rng_state.deterministic) {
+    return q * size / prob;
+  }
+  if (prob == 1) {
+    return 0;
+  }
+  if (q * size < nbinomial_inversion_max_mean<real_type>() * prob) {
+    const real_type p0 = mcstate::math::exp(size * mcstate::math::log(prob));
+    return nbinomial_inversion(rng_state, size, p0, q);
+  }
+  return poisson(rng_state, gamma(rng_state, size, q / prob));
 }
 
-}
+/// Draw random number from the negative binomial distribution,
+/// parameterised by the target number of successful trials and the
+/// mean, as for `density::negative_binomial_mu`. This is equivalent
+/// to `nbinomial(size, size / (size + mu))` but does not lose
+/// precision where `mu` is small relative to `size`.
+///
+/// @param size The target number of successful trials (the
+/// dispersion parameter)
+///
+/// @param mu The mean of the distribution
+template <typename real_type, typename rng_state_type>
+real_type nbinomial_mu(rng_state_type& rng_state, real_type size,
+                       real_type mu) {
+#ifdef __CUDA_ARCH__
+  static_assert("nbinomial_mu() not implemented for GPU targets");
+#endif
+  nbinomial_mu_validate(size, mu);
+
+  if (rng_state.deterministic) {
+    return mu;
+  }
+  if (mu == 0) {
+    return 0;
+  }
+  if (mu < nbinomial_inversion_max_mean<real_type>()) {
+    const real_type p0 = mcstate::math::exp(-size * mcstate::math::log1p(mu / size));
+    return nbinomial_inversion(rng_state, size, p0, mu / (size + mu));
+  }
+  return poisson(rng_state, gamma(rng_state, size, mu / size));
 }
 
+}
+}
@@ -14,6 +14,16 @@
 namespace mcstate {
 namespace random {
 
+// The Box-Muller transform of a pair of uniforms, with u1 above
+// epsilon; this is split out so that normals can be built from
+// uniforms that have already been drawn (see buffered_stream)
+template <typename real_type>
+__host__ __device__
+real_type box_muller(real_type u1, real_type u2) {
+  const real_type two_pi = 2 * M_PI;
+  return mcstate::math::sqrt(-2 * mcstate::math::log(u1)) * std::cos(two_pi * u2);
+}
+
 __nv_exec_check_disable__
 template <typename real_type, typename rng_state_type>
 __host__ __device__
@@ -22,7 +32,6 @@ real_type random_normal_box_muller(rng_state_type& rng_state) {
   // https://en.wikipedia.org/wiki/Box%E2%80%93Muller_transform#Basic_form
   // Do not send a really small number to log().
   const real_type epsilon = utils::epsilon<real_type>();
-  const real_type two_pi = 2 * M_PI;
 
   real_type u1, u2;
   do {
@@ -31,7 +40,68 @@ real_type random_normal_box_muller(rng_state_type& rng_state) {
   } while (u1 <= epsilon);
 
   SYNCWARP
-  return mcstate::math::sqrt(-2 * mcstate::math::log(u1)) * std::cos(two_pi * u2);
+  return box_muller(u1, u2);
+}
+
+/// Draw a pair of independent standard normally distributed random
+/// numbers using the Box-Muller transform. This costs the same as
+/// `random_normal_box_muller` (which discards the second number of
+/// the pair) so halves the cost per draw where many draws are needed.
+///
+/// The first number is the same as would be returned by
+/// `random_normal_box_muller` from the same state.
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param z0,z1 Destination for the pair of draws
+__nv_exec_check_disable__
+template <typename real_type, typename rng_state_type>
+__host__ __device__
+void random_normal_box_muller_pair(rng_state_type& rng_state,
+                                   real_type& z0, real_type& z1) {
+  const real_type epsilon = utils::epsilon<real_type>();
+  const real_type two_pi = 2 * M_PI;
+
+  real_type u1, u2;
+  do {
+    u1 = random_real<real_type>(rng_state);
+    u2 = random_real<real_type>(rng_state);
+  } while (u1 <= epsilon);
+
+  const real_type r = mcstate::math::sqrt(-2 * mcstate::math::log(u1));
+  real_type s, c;
+  mcstate::math::sincos(two_pi * u2, s, c);
+  z0 = r * c;
+  z1 = r * s;
+}
+
+/// Fill `dest` with `n` standard normally distributed random numbers
+/// using pairs from the Box-Muller transform; if `n` is odd, the
+/// second number of the final pair is discarded.
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param dest Destination for the draws, with space for `n` values
+///
+/// @param n The number of draws to make
+__nv_exec_check_disable__
+template <typename real_type, typename rng_state_type, typename T>
+__host__ __device__
+void random_normal_box_muller_fill(rng_state_type& rng_state, T dest,
+                                   size_t n) {
+  real_type z0, z1;
+  size_t i = 0;
+  for (; i + 1 < n; i += 2) {
+    random_normal_box_muller_pair(rng_state, z0, z1);
+    dest[i] = z0;
+    dest[i + 1] = z1;
+  }
+  if (i < n) {
+    random_normal_box_muller_pair(rng_state, z0, z1);
+    dest[i] = z0;
+  }
 }
 
 
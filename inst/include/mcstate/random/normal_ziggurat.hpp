@@ -1,12 +1,32 @@
 #pragma once
 
+#include <cstddef>
+
 #include "mcstate/random/generator.hpp"
 #include "mcstate/random/math.hpp"
 #include "mcstate/random/normal_ziggurat_tables.hpp"
 
+// The number of layers used by default in each precision, which can
+// be changed at compile time; see inst/random/ziggurat for a
+// benchmark that picks the fastest on a given machine.
+#ifndef MCSTATE_ZIGGURAT_LAYERS_DOUBLE
+#define MCSTATE_ZIGGURAT_LAYERS_DOUBLE 256
+#endif
+
+#ifndef MCSTATE_ZIGGURAT_LAYERS_FLOAT
+#define MCSTATE_ZIGGURAT_LAYERS_FLOAT 256
+#endif
+
 namespace mcstate {
 namespace random {
 
+/// The default number of ziggurat layers for `real_type`
+template <typename real_type>
+constexpr size_t ziggurat_layers() {
+  return std::is_same<real_type, float>::value ?
+    MCSTATE_ZIGGURAT_LAYERS_FLOAT : MCSTATE_ZIGGURAT_LAYERS_DOUBLE;
+}
+
 __nv_exec_check_disable__
 namespace {
 template <typename real_type, typename rng_state_type>
@@ -27,22 +47,29 @@ real_type normal_ziggurat_tail(rng_state_type& rng_state, real_type x1,
   return ret;
 }
 
+constexpr int ziggurat_log2(size_t n) {
+  return n <= 1 ? 0 : 1 + ziggurat_log2(n / 2);
+}
+
 __nv_exec_check_disable__
-template <typename rng_state_type>
+template <size_t n, typename rng_state_type>
 __host__ __device__
 int ziggurat_layer_draw(rng_state_type& rng_state,
-                        typename rng_state_type::int_type value, int n) {
+                        typename rng_state_type::int_type value) {
   using int_type = typename rng_state_type::int_type;
-  // We need to use log2(n) bits; this will be 8 while we use n = 256
-  // and it's unlikely that we will use more than that. Doing `% 8` is
-  // the same as `& 0xff` but less horrible
+  static_assert(n >= 2 && (n & (n - 1)) == 0 && n <= 2048,
+                "The number of layers must be a power of two, at most 2048");
+  // We need to use log2(n) bits; this is 8 with the default n = 256.
+  // Doing `% n` is the same as `& (n - 1)` but less horrible
   //
   // We have either an uint64_t or a uint32_t to play with.
   //
   // If the former we can partition it into chunks of 3, 8 and 53; we
   // send the 53 bits off to generate our real number later (via
   // int_to_real, see below) use the middle 8 to compute our integer
-  // on 0..255 and throw away the worst 3 bits.
+  // on 0..255 and throw away the worst 3 bits. With more than 256
+  // layers we have to keep some of those bits (all of them at 2048)
+  // as the layer must not overlap the 53.
   //
   // If we have an uint32_t we have no choice but to draw a second
   // number to compute the layer or we will overlap in bits between
@@ -58,38 +85,47 @@ int ziggurat_layer_draw(rng_state_type& rng_state,
   // It might be worth rejecting this approach for xoroshiro128+ or
   // for all rngs with a + scrambler (this is gettable at compile
   // time).
+  constexpr int shift = n <= 256 ? 3 : 11 - ziggurat_log2(n);
   if (std::is_same<int_type, uint64_t>::value) {
-    return (value >> 3) % n;
+    return (value >> shift) % n;
   } else {
     return (random_int<typename rng_state_type::int_type>(rng_state) >> 16) % n;
   }
 }
 }
 
+/// Draw a standard normal random number using the ziggurat method
+///
+/// @tparam real_type The real type to return
+///
+/// @tparam n The number of layers; tables are available for powers of
+///   two from 64 to 1024 (see ./scripts/update_ziggurat_tables). More
+///   layers accept more often on the fast path but have larger tables
+///   to keep in cache, so the best value depends on the machine;
+///   benchmarking on the CPU originally showed 256 to be the fastest
+///   of 32 to 256, but it is quite possible that a different number
+///   will be better elsewhere (e.g., on the GPU).
+///
+/// @param rng_state Reference to the random number state, will be
+///   modified as a side-effect
 __nv_exec_check_disable__
-template <typename real_type, typename rng_state_type>
+template <typename real_type, size_t n = ziggurat_layers<real_type>(),
+          typename rng_state_type>
 __host__ __device__
 real_type random_normal_ziggurat(rng_state_type& rng_state) {
-  using ziggurat::x;
-  using ziggurat::y;
-
-  // This 'n' needs to match the length of 'y'. To change, update the
-  // tables by editing and re-running ./scripts/update_ziggurat_tables
-  //
-  // Benchmarking on the CPU showed 256 to be the fastest of 32, 64,
-  // 128, 258 (it was the largest tried though), but it is quite
-  // possible that a different number will be better on the GPU. Once
-  // #327 and #324 are dealt with we could template over the number of
-  // bins.
-  constexpr size_t n = 256;
+  // Tables and arithmetic are all in real_type, so that single
+  // precision draws never convert to double
+  const real_type * x = ziggurat::table<real_type, n>::x();
+  const real_type * y = ziggurat::table<real_type, n>::y();
   const real_type r = x[1];
+  const real_type half = 0.5;
 
   using int_type = typename rng_state_type::int_type;
 
   real_type ret;
   do {
     const auto value = random_int<int_type>(rng_state);
-    const auto i = ziggurat_layer_draw(rng_state, value, n);
+    const auto i = ziggurat_layer_draw<n>(rng_state, value);
     const auto u0 = 2 * int_to_real<real_type>(value) - 1;
 
     if (mcstate::math::abs(u0) < y[i]) {
@@ -101,10 +137,10 @@ real_type random_normal_ziggurat(rng_state_type& rng_state) {
       break;
     }
     const auto z = u0 * x[i];
-    const auto f0 = mcstate::math::exp(-0.5 * (x[i] * x[i] - z * z));
-    const auto f1 = mcstate::math::exp(-0.5 * (x[i + 1] * x[i + 1] - z * z));
+    const auto f0 = mcstate::math::exp(-half * (x[i] * x[i] - z * z));
+    const auto f1 = mcstate::math::exp(-half * (x[i + 1] * x[i + 1] - z * z));
     const auto u1 = random_real<real_type>(rng_state);
-    if (f1 + u1 * (f0 - f1) < 1.0) {
+    if (f1 + u1 * (f0 - f1) < 1) {
       ret = z;
       break;
     }
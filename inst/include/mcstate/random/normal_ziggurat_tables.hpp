@@ -1,18 +1,272 @@
 #pragma once
 // Generated by scripts/update_ziggurat_tables - do not edit
 
-#include "mcstate/random/cuda_compatibility.hpp"
+#include <cstddef>
 
-#ifndef MCSTATE_ZIGGURAT_REAL_TYPE
-#define MCSTATE_ZIGGURAT_REAL_TYPE double
-#endif
+#include "mcstate/random/cuda_compatibility.hpp"
 
 namespace mcstate {
 namespace random {
 namespace ziggurat {
 
+// For an n-layer ziggurat, 'x' (length n + 1) holds the layer
+// boundaries, starting with the base (the tail start divided by
+// its density), and 'y' (length n) the ratio of each boundary to the
+// one below it. Tables are given for 64 to 1024 layers, in each
+// precision; access them through 'table<real_type, n>'.
+
+CONSTANT
+double x_64_d[65] = {
+    3.5008184277364887, 3.2136576271588955, 2.9755475488121643,
+    2.821441733766938, 2.7048984408762364, 2.6098964948842038,
+    2.528938180557692, 2.4578883927994299, 2.3942152384559483,
+    2.3362511737843308, 2.2828369954770573, 2.2331325511090476,
+    2.1865083181739338, 2.1424795678022339, 2.1006644566838557,
+    2.0607562912744344, 2.0225045605567904, 1.9857015973505139,
+    1.9501729679923052, 1.9157703997057938, 1.8823664766124535,
+    1.8498505942678831, 1.8181258262770674, 1.7871064626699495,
+    1.7567160501140573, 1.7268858116894925, 1.6975533567908516,
+    1.6686616147182951, 1.6401579418516612, 1.6119933640360706,
+    1.5841219243153439, 1.5565001123514342, 1.5290863563890635,
+    1.5018405618916264, 1.4747236832774091, 1.4476973167176226,
+    1.4207233028407453, 1.3937633284849049, 1.3667785163646917,
+    1.3397289906342564, 1.3125734047423601, 1.2852684155251939,
+    1.2577680839133578, 1.2300231775504378, 1.2019803434433676,
+    1.1735811085966903, 1.144760652055461, 1.1154462707628696,
+    1.0855554307417703, 1.0549932488310858, 1.0236491793760771,
+    0.99139256915097762, 0.95806656450075678, 0.92347955596060394,
+    0.88739282913066808, 0.84950215837842302, 0.80940930996813953,
+    0.76657585061496369, 0.72024390140576477, 0.66928999392571908,
+    0.61192851624030953, 0.54502400011307439, 0.46213734103863208,
+    0.34553857472349936, 0
+};
+
+CONSTANT
+double y_64_d[64] = {
+    0.91797323782848639, 0.92590683079166791, 0.9482092581223428,
+    0.95869370914312546, 0.9648778140589791, 0.96898025860979453,
+    0.97190528882655647, 0.97409436712829722, 0.97578995249023681,
+    0.97713679979847734, 0.97822689729205892, 0.97912160077020116,
+    0.97986344254639268, 0.98048284252191387, 0.98100212278908117,
+    0.98143801337421221, 0.98180327306844506, 0.98210777016767581,
+    0.98235922205304238, 0.98256371269831178, 0.98272606171616128,
+    0.98285009173761329, 0.9829388246078461, 0.98299462668245918,
+    0.98301931696780021, 0.98301424755471034, 0.9829803629105508,
+    0.98291824261119232, 0.98282813069588038, 0.98270995381088733,
+    0.98256332953926639, 0.98238756570280217, 0.98218165090310661,
+    0.98194423609117165, 0.98167360647540192, 0.98136764255525755,
+    0.98102376845517081, 0.98063888497515062, 0.98020928379648475,
+    0.97973053798064014, 0.9791973621296054, 0.97860343311976683,
+    0.97794115885291355, 0.97720137748711622, 0.97637296233537341,
+    0.97544229680410299, 0.9743925673546201, 0.97320279711845148,
+    0.97184650267946149, 0.97028979143730321, 0.9684886083289197,
+    0.96638465358000314, 0.96389915917984681, 0.9609230907202938,
+    0.95730113033551945, 0.95280430071323785, 0.94708059466864558,
+    0.93955986329072272, 0.92925464918120881, 0.91429503174109039,
+    0.89066612463446437, 0.84792108410410172, 0.7476967213835557, 0
+};
+
+CONSTANT
+float x_64_f[65] = {
+    3.50081843f, 3.21365763f, 2.97554755f, 2.82144173f, 2.70489844f,
+    2.60989649f, 2.52893818f, 2.45788839f, 2.39421524f, 2.33625117f,
+    2.282837f, 2.23313255f, 2.18650832f, 2.14247957f, 2.10066446f,
+    2.06075629f, 2.02250456f, 1.9857016f, 1.95017297f, 1.9157704f,
+    1.88236648f, 1.84985059f, 1.81812583f, 1.78710646f, 1.75671605f,
+    1.72688581f, 1.69755336f, 1.66866161f, 1.64015794f, 1.61199336f,
+    1.58412192f, 1.55650011f, 1.52908636f, 1.50184056f, 1.47472368f,
+    1.44769732f, 1.4207233f, 1.39376333f, 1.36677852f, 1.33972899f,
+    1.3125734f, 1.28526842f, 1.25776808f, 1.23002318f, 1.20198034f,
+    1.17358111f, 1.14476065f, 1.11544627f, 1.08555543f, 1.05499325f,
+    1.02364918f, 0.991392569f, 0.958066565f, 0.923479556f,
+    0.887392829f, 0.849502158f, 0.80940931f, 0.766575851f,
+    0.720243901f, 0.669289994f, 0.611928516f, 0.545024f,
+    0.462137341f, 0.345538575f, 0.0f
+};
+
+CONSTANT
+float y_64_f[64] = {
+    0.917973238f, 0.925906831f, 0.948209258f, 0.958693709f,
+    0.964877814f, 0.968980259f, 0.971905289f, 0.974094367f,
+    0.975789952f, 0.9771368f, 0.978226897f, 0.979121601f,
+    0.979863443f, 0.980482843f, 0.981002123f, 0.981438013f,
+    0.981803273f, 0.98210777f, 0.982359222f, 0.982563713f,
+    0.982726062f, 0.982850092f, 0.982938825f, 0.982994627f,
+    0.983019317f, 0.983014248f, 0.982980363f, 0.982918243f,
+    0.982828131f, 0.982709954f, 0.98256333f, 0.982387566f,
+    0.982181651f, 0.981944236f, 0.981673606f, 0.981367643f,
+    0.981023768f, 0.980638885f, 0.980209284f, 0.979730538f,
+    0.979197362f, 0.978603433f, 0.977941159f, 0.977201377f,
+    0.976372962f, 0.975442297f, 0.974392567f, 0.973202797f,
+    0.971846503f, 0.970289791f, 0.968488608f, 0.966384654f,
+    0.963899159f, 0.960923091f, 0.95730113f, 0.952804301f,
+    0.947080595f, 0.939559863f, 0.929254649f, 0.914295032f,
+    0.890666125f, 0.847921084f, 0.747696721f, 0.0f
+};
+
 CONSTANT
-MCSTATE_ZIGGURAT_REAL_TYPE x[257] = {
+double x_128_d[129] = {
+    3.7130862467403638, 3.4426198558966523, 3.2230849845786187,
+    3.083228858214214, 2.9786962526450171, 2.8943440070186708,
+    2.8231253505459666, 2.7611693723841539, 2.7061135731187225,
+    2.6564064112581929, 2.6109722484286135, 2.5690336259216395,
+    2.530009672385467, 2.4934545220919513, 2.4590181774083506,
+    2.4264206455302122, 2.395434278007468, 2.3658713701139882,
+    2.3375752413355313, 2.3104136836950024, 2.284274059673657,
+    2.2590595738653296, 2.2346863955870568, 2.2110814088747275,
+    2.1881804320720204, 2.1659267937448408, 2.1442701823562613,
+    2.1231657086697902, 2.1025731351849992, 2.0824562379877252,
+    2.0627822745039639, 2.0435215366506703, 2.0246469733729344,
+    2.0061338699589673, 1.9879595741230611, 1.9701032608497138,
+    1.9525457295488895, 1.9352692282919008, 1.9182573008597328,
+    1.9014946531003185, 1.8849670357028701, 1.8686611409895428,
+    1.852564511723088, 1.836665460253385, 1.8209529965910061,
+    1.8054167642140497, 1.7900469825946199, 1.7748343955807702,
+    1.7597702248942328, 1.7448461281083774, 1.7300541605582445,
+    1.7153867407081174, 1.7008366185643018, 1.6863968467734873,
+    1.6720607540918533, 1.6578219209482088, 1.6436741568569839,
+    1.6296114794646797, 1.615628095037134, 1.6017183802152781,
+    1.5878768648844017, 1.5740982160167507, 1.5603772223598418,
+    1.5467087798535044, 1.5330878776675572, 1.5195095847593718,
+    1.5059690368565513, 1.4924614237746163, 1.4789819769830987,
+    1.4655259573357955, 1.4520886428822175, 1.4386653166774623,
+    1.4252512545068625, 1.4118417124397613, 1.3984319141236075,
+    1.3850170377251498, 1.3715922024197336, 1.3581524543224242,
+    1.3446927517457143, 1.3312079496576779, 1.3176927832013443,
+    1.3041418501204227, 1.2905495919178744, 1.2769102735517011,
+    1.2632179614460297, 1.2494664995643352, 1.2356494832544827,
+    1.2217602305309641, 1.207791750406759, 1.1937367078237737,
+    1.1795873846544622, 1.1653356361550484, 1.1509728421389775,
+    1.1364898520030771, 1.1218769225722556, 1.1071236475235371,
+    1.0922188768965555, 1.0771506248819394, 1.061905963683621,
+    1.0464709007525819, 1.0308302360564572, 1.0149673952393012,
+    0.99886423348064535, 0.98250080350276225, 0.96585507938813253,
+    0.94890262549791382, 0.93161619660135586, 0.91396525100880388,
+    0.89591535256624066, 0.87742742909771787, 0.85845684317805315,
+    0.8389522142812097, 0.81885390668332014, 0.79809206062627724,
+    0.77658398787615102, 0.75423066443451292, 0.73091191062188421,
+    0.70647961131361103, 0.68074791864590745, 0.65347863871504597,
+    0.62435859730909204, 0.59296294244198222, 0.55869217837552276,
+    0.52065603872515043, 0.47743783725379418, 0.42654798630331281,
+    0.36287143102842823, 0.2723208647046797, 0
+};
+
+CONSTANT
+double y_128_d[128] = {
+    0.92715860260958172, 0.93623028957379484, 0.95660799295284815,
+    0.96609638454482372, 0.9716814879827228, 0.97539385218204822,
+    0.97805411716846691, 0.98006069464044032, 0.98163153152391769,
+    0.98289638112714095, 0.98393754566628799, 0.9848098704733097,
+    0.9855513792328513, 0.98618930308193098, 0.98674367998674406,
+    0.98722959781115238, 0.98765864371028778, 0.98803987015697581,
+    0.98838045631206695, 0.98868617156926597, 0.98896170724281229,
+    0.98921091831298213, 0.98943700254364852, 0.98964263517806794,
+    0.98983007159692615, 0.99000122651830924, 0.99015773578342625,
+    0.99030100505075858, 0.99043224853365019, 0.99055252008427697,
+    0.99066273833581142, 0.99076370718917339, 0.99085613262092531,
+    0.99094063656067088, 0.99101776841653122, 0.99108801469967034,
+    0.99115180710211581, 0.991209529308135, 0.99126152276240442,
+    0.99130809157390964, 0.99134950669986277, 0.99138600952662237,
+    0.9914178149429651, 0.99144511398378932, 0.99146807610847643,
+    0.99148685116695434, 0.99150157109742476, 0.99151235139230665,
+    0.9915192923628694, 0.99152248022800205, 0.99152198804840064,
+    0.99151787652397894, 0.99151019466937207, 0.99149898037993689,
+    0.99148426089853536, 0.99146605319156778, 0.99144436424114935,
+    0.99141919125892564, 0.99139052182579424, 0.99135833396067041,
+    0.99132259612041507, 0.99128326713206638, 0.99124029605759956,
+    0.99119362199053573, 0.99114317378280792, 0.99108886969938736,
+    0.99103061699719286, 0.99096831142380459, 0.99090183663038844,
+    0.99083106349204086, 0.99075584932741334, 0.99067603700798246,
+    0.99059145394561265, 0.99050191094511519, 0.99040720090626311,
+    0.9903070973571082, 0.99020135279742816, 0.99008969682757386,
+    0.98997183403381173, 0.98984744159632687, 0.98971616658019523,
+    0.98957762286265627, 0.98943138764167593, 0.98927699746076403,
+    0.98911394367290906, 0.98894166725184685, 0.98875955284103967,
+    0.98856692190894568, 0.98836302485237881, 0.9881470318567096,
+    0.98791802228065662, 0.98767497228226886, 0.98741674033855986,
+    0.98714205023030688, 0.98684947096077891, 0.98653739294583653,
+    0.98620399964388894, 0.98584723357516579, 0.98546475539369149,
+    0.98505389429856438, 0.98461158757057732, 0.98413430634896482,
+    0.9836179638539434, 0.9830578010162585, 0.98244824275194775,
+    0.98178271570543152, 0.98105341485372977, 0.98025100142194643,
+    0.97936420732654439, 0.97837931059532446, 0.97727942988416716,
+    0.97604356093736611, 0.9746452378286421, 0.97305063687358517,
+    0.97121583268440637, 0.96908272904800019, 0.96657285378276936,
+    0.96357758630874191, 0.95994217656206204, 0.95543841882389069,
+    0.949715347874729, 0.9422042060076754, 0.93191932673736755,
+    0.91699279705431258, 0.89341051969571994, 0.85071654932253038,
+    0.7504610212297077, 0
+};
+
+CONSTANT
+float x_128_f[129] = {
+    3.71308625f, 3.44261986f, 3.22308498f, 3.08322886f, 2.97869625f,
+    2.89434401f, 2.82312535f, 2.76116937f, 2.70611357f, 2.65640641f,
+    2.61097225f, 2.56903363f, 2.53000967f, 2.49345452f, 2.45901818f,
+    2.42642065f, 2.39543428f, 2.36587137f, 2.33757524f, 2.31041368f,
+    2.28427406f, 2.25905957f, 2.2346864f, 2.21108141f, 2.18818043f,
+    2.16592679f, 2.14427018f, 2.12316571f, 2.10257314f, 2.08245624f,
+    2.06278227f, 2.04352154f, 2.02464697f, 2.00613387f, 1.98795957f,
+    1.97010326f, 1.95254573f, 1.93526923f, 1.9182573f, 1.90149465f,
+    1.88496704f, 1.86866114f, 1.85256451f, 1.83666546f, 1.820953f,
+    1.80541676f, 1.79004698f, 1.7748344f, 1.75977022f, 1.74484613f,
+    1.73005416f, 1.71538674f, 1.70083662f, 1.68639685f, 1.67206075f,
+    1.65782192f, 1.64367416f, 1.62961148f, 1.6156281f, 1.60171838f,
+    1.58787686f, 1.57409822f, 1.56037722f, 1.54670878f, 1.53308788f,
+    1.51950958f, 1.50596904f, 1.49246142f, 1.47898198f, 1.46552596f,
+    1.45208864f, 1.43866532f, 1.42525125f, 1.41184171f, 1.39843191f,
+    1.38501704f, 1.3715922f, 1.35815245f, 1.34469275f, 1.33120795f,
+    1.31769278f, 1.30414185f, 1.29054959f, 1.27691027f, 1.26321796f,
+    1.2494665f, 1.23564948f, 1.22176023f, 1.20779175f, 1.19373671f,
+    1.17958738f, 1.16533564f, 1.15097284f, 1.13648985f, 1.12187692f,
+    1.10712365f, 1.09221888f, 1.07715062f, 1.06190596f, 1.0464709f,
+    1.03083024f, 1.0149674f, 0.998864233f, 0.982500804f,
+    0.965855079f, 0.948902625f, 0.931616197f, 0.913965251f,
+    0.895915353f, 0.877427429f, 0.858456843f, 0.838952214f,
+    0.818853907f, 0.798092061f, 0.776583988f, 0.754230664f,
+    0.730911911f, 0.706479611f, 0.680747919f, 0.653478639f,
+    0.624358597f, 0.592962942f, 0.558692178f, 0.520656039f,
+    0.477437837f, 0.426547986f, 0.362871431f, 0.272320865f, 0.0f
+};
+
+CONSTANT
+float y_128_f[128] = {
+    0.927158603f, 0.93623029f, 0.956607993f, 0.966096385f,
+    0.971681488f, 0.975393852f, 0.978054117f, 0.980060695f,
+    0.981631532f, 0.982896381f, 0.983937546f, 0.98480987f,
+    0.985551379f, 0.986189303f, 0.98674368f, 0.987229598f,
+    0.987658644f, 0.98803987f, 0.988380456f, 0.988686172f,
+    0.988961707f, 0.989210918f, 0.989437003f, 0.989642635f,
+    0.989830072f, 0.990001227f, 0.990157736f, 0.990301005f,
+    0.990432249f, 0.99055252f, 0.990662738f, 0.990763707f,
+    0.990856133f, 0.990940637f, 0.991017768f, 0.991088015f,
+    0.991151807f, 0.991209529f, 0.991261523f, 0.991308092f,
+    0.991349507f, 0.99138601f, 0.991417815f, 0.991445114f,
+    0.991468076f, 0.991486851f, 0.991501571f, 0.991512351f,
+    0.991519292f, 0.99152248f, 0.991521988f, 0.991517877f,
+    0.991510195f, 0.99149898f, 0.991484261f, 0.991466053f,
+    0.991444364f, 0.991419191f, 0.991390522f, 0.991358334f,
+    0.991322596f, 0.991283267f, 0.991240296f, 0.991193622f,
+    0.991143174f, 0.99108887f, 0.991030617f, 0.990968311f,
+    0.990901837f, 0.990831063f, 0.990755849f, 0.990676037f,
+    0.990591454f, 0.990501911f, 0.990407201f, 0.990307097f,
+    0.990201353f, 0.990089697f, 0.989971834f, 0.989847442f,
+    0.989716167f, 0.989577623f, 0.989431388f, 0.989276997f,
+    0.989113944f, 0.988941667f, 0.988759553f, 0.988566922f,
+    0.988363025f, 0.988147032f, 0.987918022f, 0.987674972f,
+    0.98741674f, 0.98714205f, 0.986849471f, 0.986537393f, 0.986204f,
+    0.985847234f, 0.985464755f, 0.985053894f, 0.984611588f,
+    0.984134306f, 0.983617964f, 0.983057801f, 0.982448243f,
+    0.981782716f, 0.981053415f, 0.980251001f, 0.979364207f,
+    0.978379311f, 0.97727943f, 0.976043561f, 0.974645238f,
+    0.973050637f, 0.971215833f, 0.969082729f, 0.966572854f,
+    0.963577586f, 0.959942177f, 0.955438419f, 0.949715348f,
+    0.942204206f, 0.931919327f, 0.916992797f, 0.89341052f,
+    0.850716549f, 0.750461021f, 0.0f
+};
+
+CONSTANT
+double x_256_d[257] = {
     3.9107579595249158, 3.6541528853610088, 3.4492782985614312,
     3.3202447338398255, 3.2245750520478018, 3.1478892895180008,
     3.0835261320021434, 3.0278377917695938, 2.9786032798818436,
@@ -102,7 +356,7 @@ MCSTATE_ZIGGURAT_REAL_TYPE x[257] = {
 };
 
 CONSTANT
-MCSTATE_ZIGGURAT_REAL_TYPE y[256] = {
+double y_256_d[256] = {
     0.93438482339748796, 0.94393376707900467, 0.96259114123223377,
     0.97118595481322156, 0.97621833534899405, 0.97955355109527609,
     0.98194004595758333, 0.98373938259784532, 0.98514860539779225,
@@ -190,6 +444,1999 @@ MCSTATE_ZIGGURAT_REAL_TYPE y[256] = {
     0.8950104667155111, 0.85237596459780651, 0.75213489302804981, 0
 };
 
+CONSTANT
+float x_256_f[257] = {
+    3.91075796f, 3.65415289f, 3.4492783f, 3.32024473f, 3.22457505f,
+    3.14788929f, 3.08352613f, 3.02783779f, 2.97860328f, 2.93436687f,
+    2.89412105f, 2.85713873f, 2.8228774f, 2.79092117f, 2.76094401f,
+    2.73268536f, 2.70593366f, 2.68051464f, 2.65628304f, 2.63311639f,
+    2.61091052f, 2.58957599f, 2.56903545f, 2.54922155f, 2.53007523f,
+    2.51154444f, 2.49358304f, 2.47614994f, 2.45920837f, 2.44272532f,
+    2.42667098f, 2.41101841f, 2.39574312f, 2.3808228f, 2.36623706f,
+    2.35196723f, 2.33799615f, 2.32430802f, 2.31088825f, 2.29772335f,
+    2.2848008f, 2.27210899f, 2.2596371f, 2.24737503f, 2.23531338f,
+    2.22344334f, 2.21175664f, 2.20024555f, 2.18890277f, 2.17772147f,
+    2.16669518f, 2.15581782f, 2.14508363f, 2.13448718f, 2.12402332f,
+    2.11368715f, 2.10347406f, 2.09337963f, 2.08339969f, 2.07353026f,
+    2.06376755f, 2.05410793f, 2.04454797f, 2.03508435f, 2.02571395f,
+    2.01643373f, 2.00724083f, 1.99813247f, 1.98910601f, 1.9801589f,
+    1.9712887f, 1.96249306f, 1.95376974f, 1.94511656f, 1.93653143f,
+    1.92801233f, 1.91955734f, 1.91116456f, 1.90283221f, 1.89455853f,
+    1.88634183f, 1.87818049f, 1.87007292f, 1.86201761f, 1.85401306f,
+    1.84605785f, 1.83815059f, 1.83028992f, 1.82247454f, 1.81470318f,
+    1.80697459f, 1.79928758f, 1.79164099f, 1.78403366f, 1.7764645f,
+    1.76893241f, 1.76143637f, 1.75397532f, 1.74654828f, 1.73915426f,
+    1.73179231f, 1.7244615f, 1.71716092f, 1.70988966f, 1.70264685f,
+    1.69543165f, 1.68824321f, 1.6810807f, 1.67394333f, 1.6668303f,
+    1.65974082f, 1.65267415f, 1.64562952f, 1.6386062f, 1.63160346f,
+    1.62462058f, 1.61765687f, 1.61071162f, 1.60378416f, 1.59687379f,
+    1.58997987f, 1.58310172f, 1.5762387f, 1.56939016f, 1.56255547f,
+    1.55573398f, 1.54892509f, 1.54212815f, 1.53534257f, 1.52856773f,
+    1.52180302f, 1.51504784f, 1.5083016f, 1.50156369f, 1.49483352f,
+    1.4881105f, 1.48139404f, 1.47468356f, 1.46797846f, 1.46127816f,
+    1.45458208f, 1.44788963f, 1.44120022f, 1.43451328f, 1.4278282f,
+    1.4211444f, 1.41446129f, 1.40777828f, 1.40109476f, 1.39441015f,
+    1.38772384f, 1.38103521f, 1.37434367f, 1.36764858f, 1.36094934f,
+    1.35424532f, 1.34753587f, 1.34082037f, 1.33409815f, 1.32736858f,
+    1.32063098f, 1.31388467f, 1.30712899f, 1.30036323f, 1.29358669f,
+    1.28679866f, 1.27999842f, 1.27318521f, 1.26635829f, 1.25951689f,
+    1.25266022f, 1.2457875f, 1.23889789f, 1.23199057f, 1.22506469f,
+    1.21811938f, 1.21115373f, 1.20416683f, 1.19715775f, 1.19012552f,
+    1.18306914f, 1.17598761f, 1.16887988f, 1.16174486f, 1.15458145f,
+    1.14738851f, 1.14016484f, 1.13290925f, 1.12562046f, 1.11829717f,
+    1.11093805f, 1.10354168f, 1.09610663f, 1.08863139f, 1.08111441f,
+    1.07355407f, 1.06594867f, 1.05829648f, 1.05059566f, 1.04284431f,
+    1.03504044f, 1.02718197f, 1.01926672f, 1.01129242f, 1.00325668f,
+    0.995157f, 0.986990747f, 0.978755155f, 0.970447311f,
+    0.962064143f, 0.95360241f, 0.945058684f, 0.93642934f,
+    0.927710533f, 0.918898184f, 0.909987953f, 0.900975224f,
+    0.891855071f, 0.88262223f, 0.873271068f, 0.863795546f,
+    0.854189171f, 0.844444955f, 0.834555354f, 0.824512209f,
+    0.81430667f, 0.803929117f, 0.793369059f, 0.782615023f,
+    0.771654424f, 0.760473406f, 0.749056662f, 0.737387211f,
+    0.725446141f, 0.713212285f, 0.700661841f, 0.687767893f,
+    0.674499823f, 0.660822574f, 0.646695715f, 0.632072236f,
+    0.61689699f, 0.601104618f, 0.584616766f, 0.567338257f,
+    0.549151702f, 0.529909721f, 0.50942333f, 0.487443966f,
+    0.463634337f, 0.437518402f, 0.408389135f, 0.375121333f,
+    0.335737519f, 0.286174592f, 0.215241896f, 0.0f
+};
+
+CONSTANT
+float y_256_f[256] = {
+    0.934384823f, 0.943933767f, 0.962591141f, 0.971185955f,
+    0.976218335f, 0.979553551f, 0.981940046f, 0.983739383f,
+    0.985148605f, 0.986284669f, 0.98722157f, 0.988008516f,
+    0.988679557f, 0.989259041f, 0.989764861f, 0.990210471f,
+    0.990606195f, 0.990960092f, 0.991278548f, 0.991566694f,
+    0.991828701f, 0.992067993f, 0.992287416f, 0.992489347f,
+    0.992675795f, 0.992848464f, 0.993008815f, 0.993158102f,
+    0.993297414f, 0.993427696f, 0.993549776f, 0.993664381f,
+    0.993772152f, 0.993873656f, 0.9939694f, 0.994059833f,
+    0.994145358f, 0.994226338f, 0.994303099f, 0.994375935f,
+    0.994445112f, 0.994510873f, 0.994573437f, 0.994633006f,
+    0.994689763f, 0.994743875f, 0.994795496f, 0.994844769f,
+    0.994891823f, 0.994936778f, 0.994979746f, 0.995020829f,
+    0.995060122f, 0.995097714f, 0.995133686f, 0.995168114f,
+    0.99520107f, 0.99523262f, 0.995262824f, 0.995291742f,
+    0.995319426f, 0.995345928f, 0.995371294f, 0.995395569f,
+    0.995418794f, 0.995441008f, 0.995462249f, 0.99548255f,
+    0.995501944f, 0.995520461f, 0.99553813f, 0.995554979f,
+    0.995571033f, 0.995586315f, 0.995600849f, 0.995614656f,
+    0.995627756f, 0.995640169f, 0.995651911f, 0.995663002f,
+    0.995673455f, 0.995683287f, 0.995692513f, 0.995701144f,
+    0.995709194f, 0.995716676f, 0.9957236f, 0.995729977f,
+    0.995735817f, 0.99574113f, 0.995745924f, 0.995750208f,
+    0.995753989f, 0.995757275f, 0.995760073f, 0.995762388f,
+    0.995764227f, 0.995765595f, 0.995766497f, 0.995766938f,
+    0.995766922f, 0.995766454f, 0.995765535f, 0.99576417f,
+    0.995762361f, 0.995760111f, 0.995757421f, 0.995754294f,
+    0.995750731f, 0.995746734f, 0.995742302f, 0.995737436f,
+    0.995732137f, 0.995726405f, 0.995720238f, 0.995713637f,
+    0.9957066f, 0.995699127f, 0.995691215f, 0.995682862f,
+    0.995674067f, 0.995664826f, 0.995655138f, 0.995644999f,
+    0.995634405f, 0.995623353f, 0.995611839f, 0.995599859f,
+    0.995587407f, 0.995574479f, 0.995561069f, 0.995547173f,
+    0.995532783f, 0.995517893f, 0.995502497f, 0.995486587f,
+    0.995470156f, 0.995453196f, 0.995435699f, 0.995417655f,
+    0.995399056f, 0.995379892f, 0.995360153f, 0.995339828f,
+    0.995318906f, 0.995297375f, 0.995275224f, 0.995252439f,
+    0.995229007f, 0.995204915f, 0.995180147f, 0.995154689f,
+    0.995128524f, 0.995101636f, 0.995074007f, 0.99504562f,
+    0.995016455f, 0.994986493f, 0.994955712f, 0.994924091f,
+    0.994891607f, 0.994858237f, 0.994823955f, 0.994788736f,
+    0.994752552f, 0.994715375f, 0.994677175f, 0.99463792f,
+    0.994597579f, 0.994556116f, 0.994513495f, 0.994469679f,
+    0.994424628f, 0.9943783f, 0.994330652f, 0.994281637f,
+    0.994231206f, 0.99417931f, 0.994125893f, 0.9940709f,
+    0.994014272f, 0.993955944f, 0.993895851f, 0.993833922f,
+    0.993770084f, 0.993704259f, 0.993636363f, 0.993566308f,
+    0.993494001f, 0.993419345f, 0.993342233f, 0.993262555f,
+    0.993180192f, 0.993095017f, 0.993006897f, 0.992915689f,
+    0.992821238f, 0.992723382f, 0.992621946f, 0.992516742f,
+    0.992407568f, 0.99229421f, 0.992176434f, 0.992053992f,
+    0.991926613f, 0.991794006f, 0.991655857f, 0.991511826f,
+    0.991361543f, 0.991204606f, 0.991040579f, 0.990868986f,
+    0.990689306f, 0.99050097f, 0.990303354f, 0.990095771f,
+    0.989877464f, 0.989647599f, 0.98940525f, 0.989149391f,
+    0.988878879f, 0.988592438f, 0.988288638f, 0.987965873f,
+    0.987622332f, 0.987255964f, 0.986864441f, 0.986445103f,
+    0.985994903f, 0.98551033f, 0.984987319f, 0.984421138f,
+    0.983806241f, 0.983136094f, 0.982402933f, 0.981597473f,
+    0.980708506f, 0.979722384f, 0.978622311f, 0.977387389f,
+    0.975991278f, 0.974400309f, 0.972570745f, 0.970444725f,
+    0.967944071f, 0.964960535f, 0.961339847f, 0.956854423f,
+    0.95115412f, 0.943671267f, 0.933421617f, 0.918538965f,
+    0.895010467f, 0.852375965f, 0.752134893f, 0.0f
+};
+
+CONSTANT
+double x_512_d[513] = {
+    4.0968586097934834, 3.8520461503683912, 3.6591529330911166,
+    3.5387147915535357, 3.4499415844581947, 3.3791208509098651,
+    3.319924272752552, 3.2688953201247246, 3.223933607470558,
+    3.183664678700886, 3.1471385926519719, 3.1136706092218946,
+    3.0827503897194095, 3.0539870972903134, 3.0270745842754692,
+    3.0017684330687535, 2.9778703072041908, 2.9552169815083587,
+    2.9336724639032945, 2.9131222169485818, 2.8934688401496453,
+    2.874628790279627, 2.8565298533366059, 2.8391091700186588,
+    2.8223116750508606, 2.8060888502170385, 2.7903977181709902,
+    2.7752000231739444, 2.7604615584754475, 2.7461516098484293,
+    2.7322424919497164, 2.7187091594759427, 2.7055288790496133,
+    2.6926809507675662, 2.6801464706321707, 2.6679081268478884,
+    2.6559500243346057, 2.6442575328806543, 2.632817155203476,
+    2.6216164118569676, 2.610643740460969, 2.5998884071598383,
+    2.5893404285661323, 2.5789905027294178, 2.5688299479025067,
+    2.5588506480683324, 2.5490450043483488, 2.5394058915441629,
+    2.5299266191730934, 2.5206008964495537, 2.5114228007407573,
+    2.5023867490898315, 2.4934874724540799, 2.4847199923525536,
+    2.4760795996566145, 2.4675618352909892, 2.4591624726417707,
+    2.4508775014927466, 2.4427031133329109, 2.4346356878965918,
+    2.4266717808137339, 2.4188081122618645, 2.4110415565234726,
+    2.4033691323631752, 2.3957879941483693, 2.3882954236452489,
+    2.3808888224292493, 2.3735657048553183, 2.3663236915390113,
+    2.3591605033043406, 2.3520739555586987, 2.3450619530590693,
+    2.3381224850371862, 2.331253620654397, 2.3244535047597306,
+    2.3177203539271223, 2.311052452749963, 2.3044481503730974,
+    2.2979058572441775, 2.291424042067868, 2.285001228947829,
+    2.2786359947027082, 2.2723269663435239, 2.2660728187008945,
+    2.2598722721915121, 2.2537240907141305, 2.2476270796661275,
+    2.2415800840724045, 2.2355819868190459, 2.2296317069847533,
+    2.2237281982635961, 2.217870447473131, 2.2120574731423739,
+    2.2062883241745355, 2.2005620785797926, 2.194877842273729,
+    2.189234747937379, 2.1836319539351083, 2.1780686432868341,
+    2.1725440226913233, 2.1670573215975404, 2.161607791321225,
+    2.1561947042040672, 2.1508173528130299, 2.1454750491775245,
+    2.1401671240623075, 2.1348929262740977, 2.1296518220000431,
+    2.1244431941762936, 2.1192664418850384, 2.1141209797784759,
+    2.109006237528277, 2.1039216592991927, 2.0988667032455401,
+    2.0938408410293783, 2.0888435573592505, 2.0838743495484526,
+    2.0789327270918281, 2.0740182112601642, 2.0691303347113146,
+    2.0642686411172178, 2.0594326848060356, 2.0546220304186784,
+    2.0498362525790212, 2.0450749355771594, 2.0403376730650828,
+    2.0356240677641879, 2.0309337311840725, 2.026266283352093,
+    2.0216213525531876, 2.0169985750795019, 2.0123975949893658,
+    2.007818063875213, 2.0032596406400334, 1.9987219912819885,
+    1.994204788686829, 1.9897077124277756, 1.9852304485725374,
+    1.980772689497166, 1.9763341337064502, 1.9719144856605748,
+    1.9675134556077836, 1.96313075942279, 1.9587661184507033,
+    1.9544192593562391, 1.9500899139779992, 1.9457778191876163,
+    1.9414827167535651, 1.9372043532094549, 1.9329424797266233,
+    1.9286968519908627, 1.9244672300831158, 1.9202533783639866,
+    1.9160550653619166, 1.9118720636648885, 1.9077041498155178,
+    1.9035511042094082, 1.8994127109966426, 1.8952887579862949,
+    1.8911790365538494, 1.8870833415514179, 1.8830014712206538,
+    1.8789332271082622, 1.8748784139840113, 1.8708368397611561,
+    1.8668083154191855, 1.8627926549288099, 1.85878967517911,
+    1.8547991959067696, 1.8508210396273181, 1.846855031568315,
+    1.8429009996044037, 1.8389587741941751, 1.8350281883187742,
+    1.8311090774221928, 1.8272012793531884, 1.8233046343087755,
+    1.8194189847792352, 1.8155441754945922, 1.8116800533725101,
+    1.8078264674675582, 1.8039832689218016, 1.8001503109166761,
+    1.7963274486260996, 1.7925145391707833, 1.7887114415737024,
+    1.7849180167166891, 1.7811341272981107, 1.7773596377915983,
+    1.7735944144057922, 1.7698383250450731, 1.766091239271244,
+    1.7623530282661373, 1.7586235647951125, 1.7549027231714227,
+    1.7511903792214167, 1.7474864102505538, 1.7437906950102053,
+    1.7401031136652187, 1.7364235477622192, 1.7327518801986266,
+    1.729087995192367, 1.7254317782522561, 1.7217831161490325,
+    1.7181418968870243, 1.7145080096764269, 1.7108813449061737,
+    1.7072617941173831, 1.7036492499773619, 1.7000436062541504,
+    1.6964447577915911, 1.692852600484906, 1.6892670312567661,
+    1.68568794803384, 1.6821152497238037, 1.6785488361928016,
+    1.6749886082433414, 1.6714344675926125, 1.667886316851213,
+    1.6643440595022734, 1.6608075998809653, 1.6572768431543823,
+    1.6537516953017841, 1.6502320630951883, 1.6467178540803025,
+    1.6432089765577866, 1.6397053395648316, 1.6362068528570475,
+    1.6327134268906511, 1.6292249728049419, 1.625741402405058,
+    1.6222626281450041, 1.6187885631109407, 1.6153191210047275,
+    1.6118542161277127, 1.6083937633647578, 1.6049376781684936,
+    1.6014858765437963, 1.598038275032478, 1.594594790698183,
+    1.5911553411114838, 1.587719844335169, 1.5842882189097154,
+    1.580860383838939, 1.5774362585758173, 1.5740157630084763,
+    1.5705988174463357, 1.5671853426064062, 1.5637752595997334,
+    1.5603684899179802, 1.5569649554201435, 1.5535645783193988,
+    1.5501672811700669, 1.546772986854696, 1.543381618571255,
+    1.5399930998204319, 1.5366073543930308, 1.533224306357464,
+    1.5298438800473322, 1.5264660000490875, 1.5230905911897756,
+    1.51971757852485, 1.5163468873260539, 1.5129784430693645,
+    1.5096121714229953, 1.5062479982354515, 1.5028858495236295,
+    1.4995256514609625, 1.4961673303656018, 1.4928108126886297,
+    1.4894560250023021, 1.4861028939883107, 1.4827513464260655,
+    1.4794013091809877, 1.4760527091928115, 1.4727054734638885,
+    1.4693595290474899, 1.4660148030361011, 1.4626712225497038,
+    1.4593287147240426, 1.4559872066988666, 1.4526466256061468,
+    1.449306898558258, 1.4459679526361258, 1.4426297148773288,
+    1.4392921122641542, 1.4359550717115988, 1.4326185200553128,
+    1.4292823840394779, 1.4259465903046173, 1.4226110653753292,
+    1.4192757356479415, 1.4159405273780779, 1.412605366668132,
+    1.4092701794546452, 1.4059348914955785, 1.4025994283574741,
+    1.3992637154025016, 1.3959276777753806, 1.3925912403901741,
+    1.3892543279169463, 1.3859168647682771, 1.3825787750856291,
+    1.3792399827255555, 1.3759004112457462, 1.3725599838909026,
+    1.3692186235784338, 1.3658762528839667, 1.3625327940266623,
+    1.359188168854329, 1.3558422988283274, 1.3524951050082548,
+    1.349146508036402, 1.3457964281219748, 1.3424447850250685,
+    1.3390914980403883, 1.3357364859807037, 1.3323796671600288,
+    1.3290209593765168, 1.3256602798950599, 1.3222975454295798,
+    1.318932672125003, 1.3155655755389046, 1.3121961706228114,
+    1.30882437170315, 1.3054500924618293, 1.3020732459164417,
+    1.2986937444000728, 1.2953114995407007, 1.2919264222401756,
+    1.2885384226527614, 1.2851474101632234, 1.28175329336445,
+    1.2783559800345858, 1.2749553771136648, 1.2715513906797209,
+    1.2681439259243619, 1.264732887127783, 1.2613181776332045,
+    1.2578996998207099, 1.254477355080464, 1.2510510437852904,
+    1.247620665262583, 1.2441861177655289, 1.2407472984436188,
+    1.237304103312417, 1.2338564272225667, 1.2304041638280008,
+    1.2269472055533297, 1.2234854435603797, 1.2200187677138432,
+    1.2165470665460163, 1.2130702272205844, 1.2095881354954241,
+    1.2061006756843817, 1.2026077306179932, 1.1991091816031032,
+    1.1956049083813431, 1.1920947890864257, 1.1885787002002075,
+    1.1850565165074776, 1.1815281110494182, 1.1779933550756898,
+    1.1744521179950846, 1.1709042673246939, 1.1673496686375304,
+    1.1637881855085441, 1.1602196794589694, 1.1566440098989339,
+    1.1530610340682621, 1.1494706069753979, 1.145872581334372,
+    1.1422668074997311, 1.1386531333993488, 1.1350314044650256,
+    1.1314014635607892, 1.1277631509087964, 1.1241163040127353,
+    1.1204607575786221, 1.1167963434328794, 1.1131228904375789,
+    1.1094402244027246, 1.1057481679954477, 1.1020465406459752,
+    1.0983351584502292, 1.0946138340689073, 1.0908823766228815,
+    1.0871405915847512, 1.0833882806663722, 1.0796252417021763,
+    1.0758512685280848, 1.0720661508558085, 1.0682696741423174,
+    1.0644616194542471, 1.0606417633269991, 1.0568098776182795,
+    1.0529657293557997, 1.0491090805788548, 1.0452396881734722,
+    1.0413573037008093, 1.0374616732184576, 1.0335525370942902,
+    1.0296296298124694, 1.0256926797712065, 1.0217414090718384,
+    1.017775533298765, 1.0137947612897558, 1.0097987948961054,
+    1.0057873287320891, 1.0017600499131256, 0.99771663778202047,
+    0.99365676362262401, 0.98958009036018901, 0.98548627224766838,
+    0.98137495453713974, 0.97724577313549021, 0.97309835424343083,
+    0.96893231397684998, 0.96474725796944194, 0.96054278095546908,
+    0.95631846633143869, 0.95207388569538132, 0.94780859836232434,
+    0.9435221508544458, 0.93921407636428345, 0.93488389418924378,
+    0.93053110913552894, 0.92615521088944042, 0.9217556733538701,
+    0.91733195394760236, 0.91288349286486536, 0.90840971229235723,
+    0.90391001558074291, 0.8993837863673626, 0.89483038764661882,
+    0.89024916078420213, 0.88563942447097788, 0.88100047361199196,
+    0.87633157814563944, 0.8716319817875936, 0.86690090069359282,
+    0.8621375220346299, 0.85734100247747835, 0.85251046656280782,
+    0.84764500497238582, 0.84274367267602146, 0.83780548694796431,
+    0.83282942524142223, 0.82781442290869045, 0.82275937075305972,
+    0.81766311239719791, 0.81252444145103031, 0.8073420984602705,
+    0.80211476761463296, 0.79684107319236208, 0.79151957571499587,
+    0.78614876778319254, 0.7807270695609333, 0.77525282387140715,
+    0.76972429086328964, 0.76413964220087427, 0.75849695472546408,
+    0.75279420352847404, 0.7470292543686381, 0.74119985535640176,
+    0.73530362781774361, 0.72933805623704795, 0.72330047716389745,
+    0.7171880669513494, 0.71099782817289392, 0.70472657454124998,
+    0.69837091412364982, 0.69192723061435624, 0.68539166238463822,
+    0.67876007898183599, 0.6720280546905788, 0.6651908386983203,
+    0.65824332132110586, 0.65117999564001494, 0.64399491376905493,
+    0.63668163681494305, 0.62923317738975204, 0.62164193328767603,
+    0.61389961062238374, 0.60599713432177027, 0.59792454336557344,
+    0.5896708674917075, 0.58122398123881502, 0.57257043006501773,
+    0.56369522178676668, 0.55458157457488222, 0.54521061002122939,
+    0.53556097604562136, 0.52560837919468928, 0.51532499850162616,
+    0.50467874245532884, 0.49363229506873407, 0.48214187377838019,
+    0.4701555863511066, 0.45761121823147077, 0.44443319185880242,
+    0.43052828972057405, 0.41577947401086257, 0.40003666850048314,
+    0.38310248105127515, 0.36470905546559884, 0.34447835352764578,
+    0.3218489025668741, 0.29592714272089271, 0.26514267174786299,
+    0.22626870482795999, 0.17041758857740436, 0
+};
+
+CONSTANT
+double y_512_d[512] = {
+    0.94024385932190302, 0.94992447916055545, 0.96708578631726139,
+    0.97491371519761028, 0.97947190356283909, 0.98248166290312644,
+    0.98462948295338093, 0.98624559422953595, 0.98750938025635515,
+    0.98852703103650386, 0.98936558322908963, 0.99006952777506152,
+    0.9906696005862109, 0.99118774501741591, 0.99164006353256984,
+    0.9920386510827115, 0.99239277625992361, 0.99270966641709413,
+    0.99299504385456505, 0.99325350076814733, 0.99348876697457578,
+    0.99370390465571712, 0.99390145238720373, 0.99408353326276355,
+    0.99425193717007543, 0.99440818417248811, 0.99455357388730692,
+    0.99468922435304652, 0.99481610291471645, 0.99493505098231605,
+    0.99504680403966772, 0.99515200793715275, 0.9952512322520245,
+    0.99534498131617766, 0.99543370337465342, 0.99551779823564945,
+    0.99559762369516702, 0.99567350096012952, 0.99574571924815536,
+    0.99581453970673528, 0.99588019876690193, 0.99594291102469712,
+    0.99600287172650914, 0.99606025892062888, 0.99611523532637003,
+    0.99616794996324387, 0.99621853957551054, 0.99626712988158606,
+    0.99631383667302265, 0.99635876678385527, 0.99640201894788061,
+    0.99644368455875632, 0.99648384834558745, 0.99652258897480106,
+    0.99655997958756792, 0.99659608828071056, 0.99663097853793947,
+    0.99666470961732812, 0.9966973369001394, 0.99672891220544857,
+    0.99675948407442538, 0.99678909802765248, 0.99681779679842575,
+    0.99684562054462622, 0.99687260704143243, 0.9968987918568738,
+    0.99692420851198793, 0.99694888862714326, 0.99697286205590407,
+    0.99699615700766597, 0.99701880016014899, 0.99704081676271683,
+    0.99706223073138955, 0.99708306473632091, 0.99710334028242731,
+    0.99712307778379683, 0.99714229663242515, 0.9971610152617838,
+    0.99717925120566819, 0.99719702115273134, 0.99721434099707162,
+    0.99723122588520008, 0.99724769025969306, 0.99726374789979733,
+    0.99727941195923453, 0.99729469500143164, 0.99730960903237509,
+    0.99732416553127934, 0.99733837547923754, 0.99735224938600253,
+    0.99736579731504993, 0.99737902890704011, 0.99739195340180609,
+    0.99740457965896845, 0.99741691617728312, 0.99742897111280504,
+    0.99744075229595663, 0.99745226724757874, 0.99746352319402853,
+    0.9974745270813955, 0.99748528558889338, 0.99749580514148262,
+    0.99750609192177642, 0.99751615188127518, 0.99752599075097526,
+    0.99753561405139302, 0.99754502710203763, 0.99755423503037322,
+    0.99756324278029829, 0.99757205512017366, 0.9975806766504276,
+    0.99758911181076293, 0.99759736488699091, 0.99760544001751505,
+    0.99761334119948153, 0.99762107229462405, 0.99762863703481197,
+    0.99763603902732401, 0.99764328175986472, 0.9976503686053324,
+    0.99765730282635845, 0.99766408757962866, 0.99767072591999706,
+    0.99767722080440746, 0.99768357509562866, 0.99768979156581761,
+    0.99769587289991757, 0.99770182169889987, 0.99770764048285832,
+    0.99771333169396559, 0.99771889769929323, 0.99772434079351158,
+    0.99772966320146483, 0.99773486708063708, 0.99773995452350928,
+    0.99774492755981459, 0.9977497881586963, 0.99775453823077487,
+    0.99775917963012573, 0.99776371415617526, 0.9977681435555168,
+    0.99777246952365073, 0.99777669370665345, 0.99778081770277793,
+    0.99778484306398729, 0.99778877129742871, 0.99779260386684621,
+    0.99779634219393709, 0.99779998765965461, 0.99780354160545892,
+    0.99780700533451849, 0.99781038011286516, 0.9978136671705029,
+    0.99781686770247491, 0.99781998286988871, 0.99782301380090244,
+    0.99782596159167236, 0.99782882730726608, 0.99783161198253933,
+    0.99783431662298094, 0.99783694220552632, 0.99783948967933922,
+    0.997841959966565, 0.99784435396305671, 0.99784667253907344,
+    0.99784891653995345, 0.9978510867867616, 0.99785318407691503,
+    0.99785520918478365, 0.99785716286227122, 0.9978590458393729,
+    0.99786085882471454, 0.99786260250607128, 0.99786427755086848,
+    0.99786588460666381, 0.99786742430161157, 0.9978688972449119,
+    0.99787030402724242, 0.99787164522117489, 0.99787292138157702,
+    0.99787413304599959, 0.99787528073505005, 0.99787636495275234,
+    0.99787738618689337, 0.99787834490935834, 0.99787924157645247,
+    0.99788007662921197, 0.99788085049370312, 0.99788156358131075,
+    0.99788221628901697, 0.99788280899966741, 0.99788334208223051,
+    0.99788381589204411, 0.9978842307710557, 0.99788458704805183,
+    0.99788488503887873, 0.99788512504665561, 0.99788530736197956,
+    0.99788543226312076, 0.99788550001621179, 0.9978855108754292,
+    0.99788546508316711, 0.99788536287020313, 0.9978852044558596,
+    0.99788499004815523, 0.99788471984395244, 0.99788439402909668,
+    0.99788401277855054, 0.99788357625652147, 0.99788308461658293,
+    0.99788253800179072, 0.99788193654479262, 0.99788128036793367,
+    0.99788056958335403, 0.9978798042930842, 0.9978789845891316,
+    0.9978781105535659, 0.99787718225859612, 0.9978761997666441,
+    0.99787516313041325, 0.99787407239295145, 0.99787292758771151,
+    0.99787172873860397, 0.99787047586004685, 0.99786916895701261,
+    0.99786780802506658, 0.9978663930504047, 0.99786492400988525,
+    0.99786340087105629, 0.99786182359217923, 0.99786019212224797,
+    0.99785850640100371, 0.99785676635894582, 0.99785497191733874,
+    0.99785312298821405, 0.99785121947436928, 0.99784926126936191,
+    0.99784724825750026, 0.99784518031382885, 0.99784305730411094,
+    0.99784087908480701, 0.99783864550304813, 0.99783635639660606,
+    0.99783401159385965, 0.99783161091375627, 0.99782915416576912,
+    0.99782664114985165, 0.99782407165638654, 0.99782144546613094,
+    0.99781876235015765, 0.99781602206979214, 0.99781322437654507,
+    0.99781036901204057, 0.99780745570793994, 0.99780448418586198,
+    0.99780145415729726, 0.9977983653235194, 0.99779521737549104,
+    0.99779200999376472, 0.99778874284838093, 0.99778541559875911,
+    0.99778202789358539, 0.99777857937069436, 0.99777506965694762,
+    0.99777149836810564, 0.99776786510869342, 0.99776416947186508,
+    0.9977604110392585, 0.99775658938084688, 0.99775270405478544,
+    0.99774875460724921, 0.99774474057226914, 0.99774066147155915,
+    0.99773651681433895, 0.99773230609714914, 0.99772802880366251,
+    0.99772368440448544, 0.99771927235695523, 0.99771479210493075,
+    0.99771024307857337, 0.99770562469412494, 0.99770093635367429,
+    0.99769617744491956, 0.99769134734092069, 0.99768644539984508,
+    0.99768147096470505, 0.99767642336308682, 0.99767130190687048,
+    0.99766610589194216, 0.99766083459789645, 0.99765548728773046,
+    0.99765006320752669, 0.99764456158612702, 0.99763898163479769,
+    0.99763332254688208, 0.99762758349744329, 0.99762176364289634,
+    0.99761586212062869, 0.99760987804860801, 0.99760381052498004,
+    0.99759765862765148, 0.99759142141386226, 0.99758509791974292,
+    0.99757868715985898, 0.99757218812674153, 0.99756559979040271,
+    0.99755892109783617, 0.99755215097250216, 0.99754528831379619,
+    0.9975383319965021, 0.99753128087022713, 0.99752413375881877,
+    0.99751688945976436, 0.99750954674357151, 0.99750210435312792,
+    0.99749456100304257, 0.99748691537896383, 0.99747916613687815,
+    0.99747131190238447, 0.99746335126994501, 0.99745528280211426,
+    0.99744710502874001, 0.99743881644614096, 0.99743041551625555,
+    0.99742190066576331, 0.99741327028517845, 0.9974045227279128,
+    0.99739565630930604, 0.99738666930562625, 0.99737755995303545,
+    0.99736832644652007, 0.9973589669387869, 0.9973494795391189,
+    0.99733986231219485, 0.99733011327686616, 0.99732023040489337,
+    0.99731021161963729, 0.99730005479470585, 0.9972897577525528,
+    0.99727931826302707, 0.99726873404187211, 0.99725800274916987,
+    0.9972471219877308, 0.99723608930142538, 0.99722490217345561,
+    0.99721355802456291, 0.99720205421117181, 0.99719038802346383,
+    0.99717855668338329, 0.99716655734256354, 0.997154387080182,
+    0.9971420429007295, 0.99712952173169844, 0.99711682042118077,
+    0.99710393573537592, 0.99709086435600058, 0.99707760287760028,
+    0.99706414780475472, 0.99705049554917291, 0.997036642426676,
+    0.9970225846540568, 0.99700831834581671, 0.99699383951076903,
+    0.99697914404850552, 0.99696422774571902, 0.99694908627237366,
+    0.99693371517771912, 0.99691810988613561, 0.99690226569280826,
+    0.99688617775921506, 0.99686984110842691, 0.99685325062020247,
+    0.99683640102587578, 0.99681928690301769, 0.99680190266986723,
+    0.99678424257951537, 0.99676630071383132, 0.99674807097711848,
+    0.99672954708948336, 0.99671072257990323, 0.99669159077897795,
+    0.99667214481134891, 0.99665237758776215, 0.99663228179676466,
+    0.99661184989600737, 0.99659107410313341, 0.99656994638623275,
+    0.99654845845383333, 0.99652660174440755, 0.99650436741536219,
+    0.99648174633148423, 0.99645872905281041, 0.99643530582188655,
+    0.99641146655038026, 0.99638720080501086, 0.99636249779275032,
+    0.99633734634525628, 0.99631173490248737, 0.99628565149545045,
+    0.99625908372802763, 0.99623201875782041, 0.99620444327595625,
+    0.99617634348578332, 0.99614770508038586, 0.9961185132188427,
+    0.99608875250114637, 0.99605840694169034, 0.99602745994123609,
+    0.99599589425724788, 0.99596369197248802, 0.99593083446175479,
+    0.99589730235662821, 0.99586307550808695, 0.99582813294684291,
+    0.9957924528412313, 0.99575601245247403, 0.99571878808713032,
+    0.99568075504652021, 0.99564188757289418, 0.99560215879210667,
+    0.99556154065251912, 0.99552000385984574, 0.99547751780761973,
+    0.99543405050293632, 0.99538956848708882, 0.99534403675069227,
+    0.99529741864282884, 0.99524967577373435, 0.99520076791046841,
+    0.99515065286498117, 0.99509928637391809, 0.99504662196944216,
+    0.99499261084028112, 0.99493720168212607, 0.99488034053641694,
+    0.99482197061644673, 0.99476203211961023, 0.99470046202448603,
+    0.99463719387130789, 0.99457215752421335, 0.99450527891348151,
+    0.9944364797557681, 0.99436567725011216, 0.99429278374723207,
+    0.99421770638933449, 0.9941403467173161, 0.99406060024186604,
+    0.99397835597454065, 0.99389349591437559, 0.99380589448504575,
+    0.99371541791691909, 0.99362192356760981, 0.99352525917376677,
+    0.99342526202583947, 0.99332175805641287, 0.99321456083135817,
+    0.99310347043149672, 0.99298827221066543, 0.99286873541393961,
+    0.9927446116373021, 0.99261563310711365, 0.99248151075431257,
+    0.99234193205418608, 0.99219655859774447, 0.99204502335497224,
+    0.9918869275833706, 0.99172183732698549, 0.99154927944121485,
+    0.99136873706673734, 0.99117964446141893, 0.99098138108139677,
+    0.99077326478096606, 0.9905545439743495, 0.9903243885696984,
+    0.99008187944500881, 0.98982599618492628, 0.98955560273378129,
+    0.98926943053988803, 0.98896605866416687, 0.98864389019579346,
+    0.9883011241498143, 0.98793572180417, 0.9875453661493756,
+    0.98712741274977878, 0.98667882981784782, 0.98619612463571404,
+    0.9856752525543222, 0.98511150356295829, 0.98449935970803937,
+    0.9838323142371217, 0.98310263993022817, 0.98230108916032965,
+    0.98141650102212774, 0.98043528014370929, 0.97934069552757452,
+    0.97811192258098223, 0.97672271161117219, 0.97513950129794535,
+    0.97331868750727157, 0.97120257142384436, 0.96871317805928858,
+    0.96574251666647992, 0.96213664575955438, 0.95766841196662067,
+    0.95198823684147715, 0.9445292031147241, 0.93430806107543829,
+    0.91945984702994188, 0.89597280367734133, 0.85338472052182479,
+    0.75316464425329521, 0
+};
+
+CONSTANT
+float x_512_f[513] = {
+    4.09685861f, 3.85204615f, 3.65915293f, 3.53871479f, 3.44994158f,
+    3.37912085f, 3.31992427f, 3.26889532f, 3.22393361f, 3.18366468f,
+    3.14713859f, 3.11367061f, 3.08275039f, 3.0539871f, 3.02707458f,
+    3.00176843f, 2.97787031f, 2.95521698f, 2.93367246f, 2.91312222f,
+    2.89346884f, 2.87462879f, 2.85652985f, 2.83910917f, 2.82231168f,
+    2.80608885f, 2.79039772f, 2.77520002f, 2.76046156f, 2.74615161f,
+    2.73224249f, 2.71870916f, 2.70552888f, 2.69268095f, 2.68014647f,
+    2.66790813f, 2.65595002f, 2.64425753f, 2.63281716f, 2.62161641f,
+    2.61064374f, 2.59988841f, 2.58934043f, 2.5789905f, 2.56882995f,
+    2.55885065f, 2.549045f, 2.53940589f, 2.52992662f, 2.5206009f,
+    2.5114228f, 2.50238675f, 2.49348747f, 2.48471999f, 2.4760796f,
+    2.46756184f, 2.45916247f, 2.4508775f, 2.44270311f, 2.43463569f,
+    2.42667178f, 2.41880811f, 2.41104156f, 2.40336913f, 2.39578799f,
+    2.38829542f, 2.38088882f, 2.3735657f, 2.36632369f, 2.3591605f,
+    2.35207396f, 2.34506195f, 2.33812249f, 2.33125362f, 2.3244535f,
+    2.31772035f, 2.31105245f, 2.30444815f, 2.29790586f, 2.29142404f,
+    2.28500123f, 2.27863599f, 2.27232697f, 2.26607282f, 2.25987227f,
+    2.25372409f, 2.24762708f, 2.24158008f, 2.23558199f, 2.22963171f,
+    2.2237282f, 2.21787045f, 2.21205747f, 2.20628832f, 2.20056208f,
+    2.19487784f, 2.18923475f, 2.18363195f, 2.17806864f, 2.17254402f,
+    2.16705732f, 2.16160779f, 2.1561947f, 2.15081735f, 2.14547505f,
+    2.14016712f, 2.13489293f, 2.12965182f, 2.12444319f, 2.11926644f,
+    2.11412098f, 2.10900624f, 2.10392166f, 2.0988667f, 2.09384084f,
+    2.08884356f, 2.08387435f, 2.07893273f, 2.07401821f, 2.06913033f,
+    2.06426864f, 2.05943268f, 2.05462203f, 2.04983625f, 2.04507494f,
+    2.04033767f, 2.03562407f, 2.03093373f, 2.02626628f, 2.02162135f,
+    2.01699858f, 2.01239759f, 2.00781806f, 2.00325964f, 1.99872199f,
+    1.99420479f, 1.98970771f, 1.98523045f, 1.98077269f, 1.97633413f,
+    1.97191449f, 1.96751346f, 1.96313076f, 1.95876612f, 1.95441926f,
+    1.95008991f, 1.94577782f, 1.94148272f, 1.93720435f, 1.93294248f,
+    1.92869685f, 1.92446723f, 1.92025338f, 1.91605507f, 1.91187206f,
+    1.90770415f, 1.9035511f, 1.89941271f, 1.89528876f, 1.89117904f,
+    1.88708334f, 1.88300147f, 1.87893323f, 1.87487841f, 1.87083684f,
+    1.86680832f, 1.86279265f, 1.85878968f, 1.8547992f, 1.85082104f,
+    1.84685503f, 1.842901f, 1.83895877f, 1.83502819f, 1.83110908f,
+    1.82720128f, 1.82330463f, 1.81941898f, 1.81554418f, 1.81168005f,
+    1.80782647f, 1.80398327f, 1.80015031f, 1.79632745f, 1.79251454f,
+    1.78871144f, 1.78491802f, 1.78113413f, 1.77735964f, 1.77359441f,
+    1.76983833f, 1.76609124f, 1.76235303f, 1.75862356f, 1.75490272f,
+    1.75119038f, 1.74748641f, 1.7437907f, 1.74010311f, 1.73642355f,
+    1.73275188f, 1.729088f, 1.72543178f, 1.72178312f, 1.7181419f,
+    1.71450801f, 1.71088134f, 1.70726179f, 1.70364925f, 1.70004361f,
+    1.69644476f, 1.6928526f, 1.68926703f, 1.68568795f, 1.68211525f,
+    1.67854884f, 1.67498861f, 1.67143447f, 1.66788632f, 1.66434406f,
+    1.6608076f, 1.65727684f, 1.6537517f, 1.65023206f, 1.64671785f,
+    1.64320898f, 1.63970534f, 1.63620685f, 1.63271343f, 1.62922497f,
+    1.6257414f, 1.62226263f, 1.61878856f, 1.61531912f, 1.61185422f,
+    1.60839376f, 1.60493768f, 1.60148588f, 1.59803828f, 1.59459479f,
+    1.59115534f, 1.58771984f, 1.58428822f, 1.58086038f, 1.57743626f,
+    1.57401576f, 1.57059882f, 1.56718534f, 1.56377526f, 1.56036849f,
+    1.55696496f, 1.55356458f, 1.55016728f, 1.54677299f, 1.54338162f,
+    1.5399931f, 1.53660735f, 1.53322431f, 1.52984388f, 1.526466f,
+    1.52309059f, 1.51971758f, 1.51634689f, 1.51297844f, 1.50961217f,
+    1.506248f, 1.50288585f, 1.49952565f, 1.49616733f, 1.49281081f,
+    1.48945603f, 1.48610289f, 1.48275135f, 1.47940131f, 1.47605271f,
+    1.47270547f, 1.46935953f, 1.4660148f, 1.46267122f, 1.45932871f,
+    1.45598721f, 1.45264663f, 1.4493069f, 1.44596795f, 1.44262971f,
+    1.43929211f, 1.43595507f, 1.43261852f, 1.42928238f, 1.42594659f,
+    1.42261107f, 1.41927574f, 1.41594053f, 1.41260537f, 1.40927018f,
+    1.40593489f, 1.40259943f, 1.39926372f, 1.39592768f, 1.39259124f,
+    1.38925433f, 1.38591686f, 1.38257878f, 1.37923998f, 1.37590041f,
+    1.37255998f, 1.36921862f, 1.36587625f, 1.36253279f, 1.35918817f,
+    1.3558423f, 1.35249511f, 1.34914651f, 1.34579643f, 1.34244479f,
+    1.3390915f, 1.33573649f, 1.33237967f, 1.32902096f, 1.32566028f,
+    1.32229755f, 1.31893267f, 1.31556558f, 1.31219617f, 1.30882437f,
+    1.30545009f, 1.30207325f, 1.29869374f, 1.2953115f, 1.29192642f,
+    1.28853842f, 1.28514741f, 1.28175329f, 1.27835598f, 1.27495538f,
+    1.27155139f, 1.26814393f, 1.26473289f, 1.26131818f, 1.2578997f,
+    1.25447736f, 1.25105104f, 1.24762067f, 1.24418612f, 1.2407473f,
+    1.2373041f, 1.23385643f, 1.23040416f, 1.22694721f, 1.22348544f,
+    1.22001877f, 1.21654707f, 1.21307023f, 1.20958814f, 1.20610068f,
+    1.20260773f, 1.19910918f, 1.19560491f, 1.19209479f, 1.1885787f,
+    1.18505652f, 1.18152811f, 1.17799336f, 1.17445212f, 1.17090427f,
+    1.16734967f, 1.16378819f, 1.16021968f, 1.15664401f, 1.15306103f,
+    1.14947061f, 1.14587258f, 1.14226681f, 1.13865313f, 1.1350314f,
+    1.13140146f, 1.12776315f, 1.1241163f, 1.12046076f, 1.11679634f,
+    1.11312289f, 1.10944022f, 1.10574817f, 1.10204654f, 1.09833516f,
+    1.09461383f, 1.09088238f, 1.08714059f, 1.08338828f, 1.07962524f,
+    1.07585127f, 1.07206615f, 1.06826967f, 1.06446162f, 1.06064176f,
+    1.05680988f, 1.05296573f, 1.04910908f, 1.04523969f, 1.0413573f,
+    1.03746167f, 1.03355254f, 1.02962963f, 1.02569268f, 1.02174141f,
+    1.01777553f, 1.01379476f, 1.00979879f, 1.00578733f, 1.00176005f,
+    0.997716638f, 0.993656764f, 0.98958009f, 0.985486272f,
+    0.981374955f, 0.977245773f, 0.973098354f, 0.968932314f,
+    0.964747258f, 0.960542781f, 0.956318466f, 0.952073886f,
+    0.947808598f, 0.943522151f, 0.939214076f, 0.934883894f,
+    0.930531109f, 0.926155211f, 0.921755673f, 0.917331954f,
+    0.912883493f, 0.908409712f, 0.903910016f, 0.899383786f,
+    0.894830388f, 0.890249161f, 0.885639424f, 0.881000474f,
+    0.876331578f, 0.871631982f, 0.866900901f, 0.862137522f,
+    0.857341002f, 0.852510467f, 0.847645005f, 0.842743673f,
+    0.837805487f, 0.832829425f, 0.827814423f, 0.822759371f,
+    0.817663112f, 0.812524441f, 0.807342098f, 0.802114768f,
+    0.796841073f, 0.791519576f, 0.786148768f, 0.78072707f,
+    0.775252824f, 0.769724291f, 0.764139642f, 0.758496955f,
+    0.752794204f, 0.747029254f, 0.741199855f, 0.735303628f,
+    0.729338056f, 0.723300477f, 0.717188067f, 0.710997828f,
+    0.704726575f, 0.698370914f, 0.691927231f, 0.685391662f,
+    0.678760079f, 0.672028055f, 0.665190839f, 0.658243321f,
+    0.651179996f, 0.643994914f, 0.636681637f, 0.629233177f,
+    0.621641933f, 0.613899611f, 0.605997134f, 0.597924543f,
+    0.589670867f, 0.581223981f, 0.57257043f, 0.563695222f,
+    0.554581575f, 0.54521061f, 0.535560976f, 0.525608379f,
+    0.515324999f, 0.504678742f, 0.493632295f, 0.482141874f,
+    0.470155586f, 0.457611218f, 0.444433192f, 0.43052829f,
+    0.415779474f, 0.400036669f, 0.383102481f, 0.364709055f,
+    0.344478354f, 0.321848903f, 0.295927143f, 0.265142672f,
+    0.226268705f, 0.170417589f, 0.0f
+};
+
+CONSTANT
+float y_512_f[512] = {
+    0.940243859f, 0.949924479f, 0.967085786f, 0.974913715f,
+    0.979471904f, 0.982481663f, 0.984629483f, 0.986245594f,
+    0.98750938f, 0.988527031f, 0.989365583f, 0.990069528f,
+    0.990669601f, 0.991187745f, 0.991640064f, 0.992038651f,
+    0.992392776f, 0.992709666f, 0.992995044f, 0.993253501f,
+    0.993488767f, 0.993703905f, 0.993901452f, 0.994083533f,
+    0.994251937f, 0.994408184f, 0.994553574f, 0.994689224f,
+    0.994816103f, 0.994935051f, 0.995046804f, 0.995152008f,
+    0.995251232f, 0.995344981f, 0.995433703f, 0.995517798f,
+    0.995597624f, 0.995673501f, 0.995745719f, 0.99581454f,
+    0.995880199f, 0.995942911f, 0.996002872f, 0.996060259f,
+    0.996115235f, 0.99616795f, 0.99621854f, 0.99626713f,
+    0.996313837f, 0.996358767f, 0.996402019f, 0.996443685f,
+    0.996483848f, 0.996522589f, 0.99655998f, 0.996596088f,
+    0.996630979f, 0.99666471f, 0.996697337f, 0.996728912f,
+    0.996759484f, 0.996789098f, 0.996817797f, 0.996845621f,
+    0.996872607f, 0.996898792f, 0.996924209f, 0.996948889f,
+    0.996972862f, 0.996996157f, 0.9970188f, 0.997040817f,
+    0.997062231f, 0.997083065f, 0.99710334f, 0.997123078f,
+    0.997142297f, 0.997161015f, 0.997179251f, 0.997197021f,
+    0.997214341f, 0.997231226f, 0.99724769f, 0.997263748f,
+    0.997279412f, 0.997294695f, 0.997309609f, 0.997324166f,
+    0.997338375f, 0.997352249f, 0.997365797f, 0.997379029f,
+    0.997391953f, 0.99740458f, 0.997416916f, 0.997428971f,
+    0.997440752f, 0.997452267f, 0.997463523f, 0.997474527f,
+    0.997485286f, 0.997495805f, 0.997506092f, 0.997516152f,
+    0.997525991f, 0.997535614f, 0.997545027f, 0.997554235f,
+    0.997563243f, 0.997572055f, 0.997580677f, 0.997589112f,
+    0.997597365f, 0.99760544f, 0.997613341f, 0.997621072f,
+    0.997628637f, 0.997636039f, 0.997643282f, 0.997650369f,
+    0.997657303f, 0.997664088f, 0.997670726f, 0.997677221f,
+    0.997683575f, 0.997689792f, 0.997695873f, 0.997701822f,
+    0.99770764f, 0.997713332f, 0.997718898f, 0.997724341f,
+    0.997729663f, 0.997734867f, 0.997739955f, 0.997744928f,
+    0.997749788f, 0.997754538f, 0.99775918f, 0.997763714f,
+    0.997768144f, 0.99777247f, 0.997776694f, 0.997780818f,
+    0.997784843f, 0.997788771f, 0.997792604f, 0.997796342f,
+    0.997799988f, 0.997803542f, 0.997807005f, 0.99781038f,
+    0.997813667f, 0.997816868f, 0.997819983f, 0.997823014f,
+    0.997825962f, 0.997828827f, 0.997831612f, 0.997834317f,
+    0.997836942f, 0.99783949f, 0.99784196f, 0.997844354f,
+    0.997846673f, 0.997848917f, 0.997851087f, 0.997853184f,
+    0.997855209f, 0.997857163f, 0.997859046f, 0.997860859f,
+    0.997862603f, 0.997864278f, 0.997865885f, 0.997867424f,
+    0.997868897f, 0.997870304f, 0.997871645f, 0.997872921f,
+    0.997874133f, 0.997875281f, 0.997876365f, 0.997877386f,
+    0.997878345f, 0.997879242f, 0.997880077f, 0.99788085f,
+    0.997881564f, 0.997882216f, 0.997882809f, 0.997883342f,
+    0.997883816f, 0.997884231f, 0.997884587f, 0.997884885f,
+    0.997885125f, 0.997885307f, 0.997885432f, 0.9978855f,
+    0.997885511f, 0.997885465f, 0.997885363f, 0.997885204f,
+    0.99788499f, 0.99788472f, 0.997884394f, 0.997884013f,
+    0.997883576f, 0.997883085f, 0.997882538f, 0.997881937f,
+    0.99788128f, 0.99788057f, 0.997879804f, 0.997878985f,
+    0.997878111f, 0.997877182f, 0.9978762f, 0.997875163f,
+    0.997874072f, 0.997872928f, 0.997871729f, 0.997870476f,
+    0.997869169f, 0.997867808f, 0.997866393f, 0.997864924f,
+    0.997863401f, 0.997861824f, 0.997860192f, 0.997858506f,
+    0.997856766f, 0.997854972f, 0.997853123f, 0.997851219f,
+    0.997849261f, 0.997847248f, 0.99784518f, 0.997843057f,
+    0.997840879f, 0.997838646f, 0.997836356f, 0.997834012f,
+    0.997831611f, 0.997829154f, 0.997826641f, 0.997824072f,
+    0.997821445f, 0.997818762f, 0.997816022f, 0.997813224f,
+    0.997810369f, 0.997807456f, 0.997804484f, 0.997801454f,
+    0.997798365f, 0.997795217f, 0.99779201f, 0.997788743f,
+    0.997785416f, 0.997782028f, 0.997778579f, 0.99777507f,
+    0.997771498f, 0.997767865f, 0.997764169f, 0.997760411f,
+    0.997756589f, 0.997752704f, 0.997748755f, 0.997744741f,
+    0.997740661f, 0.997736517f, 0.997732306f, 0.997728029f,
+    0.997723684f, 0.997719272f, 0.997714792f, 0.997710243f,
+    0.997705625f, 0.997700936f, 0.997696177f, 0.997691347f,
+    0.997686445f, 0.997681471f, 0.997676423f, 0.997671302f,
+    0.997666106f, 0.997660835f, 0.997655487f, 0.997650063f,
+    0.997644562f, 0.997638982f, 0.997633323f, 0.997627583f,
+    0.997621764f, 0.997615862f, 0.997609878f, 0.997603811f,
+    0.997597659f, 0.997591421f, 0.997585098f, 0.997578687f,
+    0.997572188f, 0.9975656f, 0.997558921f, 0.997552151f,
+    0.997545288f, 0.997538332f, 0.997531281f, 0.997524134f,
+    0.997516889f, 0.997509547f, 0.997502104f, 0.997494561f,
+    0.997486915f, 0.997479166f, 0.997471312f, 0.997463351f,
+    0.997455283f, 0.997447105f, 0.997438816f, 0.997430416f,
+    0.997421901f, 0.99741327f, 0.997404523f, 0.997395656f,
+    0.997386669f, 0.99737756f, 0.997368326f, 0.997358967f,
+    0.99734948f, 0.997339862f, 0.997330113f, 0.99732023f,
+    0.997310212f, 0.997300055f, 0.997289758f, 0.997279318f,
+    0.997268734f, 0.997258003f, 0.997247122f, 0.997236089f,
+    0.997224902f, 0.997213558f, 0.997202054f, 0.997190388f,
+    0.997178557f, 0.997166557f, 0.997154387f, 0.997142043f,
+    0.997129522f, 0.99711682f, 0.997103936f, 0.997090864f,
+    0.997077603f, 0.997064148f, 0.997050496f, 0.997036642f,
+    0.997022585f, 0.997008318f, 0.99699384f, 0.996979144f,
+    0.996964228f, 0.996949086f, 0.996933715f, 0.99691811f,
+    0.996902266f, 0.996886178f, 0.996869841f, 0.996853251f,
+    0.996836401f, 0.996819287f, 0.996801903f, 0.996784243f,
+    0.996766301f, 0.996748071f, 0.996729547f, 0.996710723f,
+    0.996691591f, 0.996672145f, 0.996652378f, 0.996632282f,
+    0.99661185f, 0.996591074f, 0.996569946f, 0.996548458f,
+    0.996526602f, 0.996504367f, 0.996481746f, 0.996458729f,
+    0.996435306f, 0.996411467f, 0.996387201f, 0.996362498f,
+    0.996337346f, 0.996311735f, 0.996285651f, 0.996259084f,
+    0.996232019f, 0.996204443f, 0.996176343f, 0.996147705f,
+    0.996118513f, 0.996088753f, 0.996058407f, 0.99602746f,
+    0.995995894f, 0.995963692f, 0.995930834f, 0.995897302f,
+    0.995863076f, 0.995828133f, 0.995792453f, 0.995756012f,
+    0.995718788f, 0.995680755f, 0.995641888f, 0.995602159f,
+    0.995561541f, 0.995520004f, 0.995477518f, 0.995434051f,
+    0.995389568f, 0.995344037f, 0.995297419f, 0.995249676f,
+    0.995200768f, 0.995150653f, 0.995099286f, 0.995046622f,
+    0.994992611f, 0.994937202f, 0.994880341f, 0.994821971f,
+    0.994762032f, 0.994700462f, 0.994637194f, 0.994572158f,
+    0.994505279f, 0.99443648f, 0.994365677f, 0.994292784f,
+    0.994217706f, 0.994140347f, 0.9940606f, 0.993978356f,
+    0.993893496f, 0.993805894f, 0.993715418f, 0.993621924f,
+    0.993525259f, 0.993425262f, 0.993321758f, 0.993214561f,
+    0.99310347f, 0.992988272f, 0.992868735f, 0.992744612f,
+    0.992615633f, 0.992481511f, 0.992341932f, 0.992196559f,
+    0.992045023f, 0.991886928f, 0.991721837f, 0.991549279f,
+    0.991368737f, 0.991179644f, 0.990981381f, 0.990773265f,
+    0.990554544f, 0.990324389f, 0.990081879f, 0.989825996f,
+    0.989555603f, 0.989269431f, 0.988966059f, 0.98864389f,
+    0.988301124f, 0.987935722f, 0.987545366f, 0.987127413f,
+    0.98667883f, 0.986196125f, 0.985675253f, 0.985111504f,
+    0.98449936f, 0.983832314f, 0.98310264f, 0.982301089f,
+    0.981416501f, 0.98043528f, 0.979340696f, 0.978111923f,
+    0.976722712f, 0.975139501f, 0.973318688f, 0.971202571f,
+    0.968713178f, 0.965742517f, 0.962136646f, 0.957668412f,
+    0.951988237f, 0.944529203f, 0.934308061f, 0.919459847f,
+    0.895972804f, 0.853384721f, 0.753164644f, 0.0f
+};
+
+CONSTANT
+double x_1024_d[1025] = {
+    4.2734453030989945, 4.0388498461095041, 3.8560026549832624,
+    3.7426132245502854, 3.6594095557852233, 3.593267024156813,
+    3.5381475862778564, 3.4907603559675704, 3.4491089090900311,
+    3.4118885898571878, 3.3781987406232434, 3.3473908035194806,
+    3.3189818442737251, 3.2926023172888974, 3.2679629709643399,
+    3.2448330382706989, 3.2230253818266643, 3.2023860872918331,
+    3.1827869940961557, 3.1641202199453384, 3.1462940716254426,
+    3.1292299404068098, 3.112859910066144, 3.0971248894572692,
+    3.0819731371067447, 3.0673590828481516, 3.0532423773554327,
+    3.0395871185370646, 3.0263612166277762, 3.0135358691028409,
+    3.0010851233287887, 2.9889855098863278, 2.9772157332578266,
+    2.9657564094109037, 2.9545898419762713, 2.9436998303862483,
+    2.9330715046357274, 2.9226911823411719, 2.9125462445725248,
+    2.9026250275675034, 2.8929167279449106, 2.8834113194414002,
+    2.8740994795260244, 2.8649725245151787, 2.8560223520299628,
+    2.8472413898182625, 2.8386225501127211, 2.8301591888192519,
+    2.8218450689336065, 2.8136743276695615, 2.805641446854553,
+    2.7977412262095047, 2.7899687591811384, 2.7823194110388121,
+    2.774788798985206, 2.767372774062026, 2.7600674046591998,
+    2.7528689614595128, 2.7457739036708655, 2.7387788664158306,
+    2.7318806491633496, 2.7250762051005943, 2.7183626313544842,
+    2.7117371599823916, 2.7051971496603255, 2.6987400780045858,
+    2.692363534469647, 2.6860652137709815, 2.6798429097867973,
+    2.6736945098973144, 2.667617989724318, 2.6616114082373969,
+    2.6556729031965136, 2.6498006869034567, 2.6439930422373141,
+    2.6382483189514021, 2.6325649302111689, 2.6269413493544325,
+    2.6213761068569794, 2.6158677874880509, 2.6104150276415865,
+    2.6050165128303062, 2.599670975330818, 2.5943771919689178,
+    2.5891339820351518, 2.5839402053215275, 2.5787947602709882,
+    2.5736965822319426, 2.5686446418107503, 2.5636379433156149,
+    2.5586755232858485, 2.5537564491009261, 2.5488798176641745,
+    2.5440447541563249, 2.5392504108545113, 2.5344959660126198,
+    2.5297806227991892, 2.525103608289339, 2.5204641725074466,
+    2.5158615875175294, 2.5112951465584969, 2.5067641632216322,
+    2.5022679706678459, 2.4978059208824068, 2.4933773839650089,
+    2.4889817474531766, 2.4846184156771423, 2.4802868091444434,
+    2.4759863639526145, 2.471716531228433, 2.4674767765922954,
+    2.4632665796463735, 2.4590854334852912, 2.4549328442281424,
+    2.4508083305707342, 2.446711423357014, 2.4426416651686993,
+    2.4385986099321864, 2.4345818225418672, 2.4305908784990411,
+    2.426625363565643, 2.4226848734320692, 2.4187690133984114,
+    2.4148773980684504, 2.4110096510558034, 2.4071654047016451,
+    2.4033442998034591, 2.3995459853543046, 2.3957701182921101,
+    2.3920163632585338, 2.3882843923669546, 2.3845738849791798,
+    2.3808845274904793, 2.3772160131225721, 2.3735680417242171,
+    2.3699403195790714, 2.3663325592205, 2.3627444792530383,
+    2.3591758041802176, 2.3556262642384849, 2.3520955952369587,
+    2.3485835384027762, 2.3450898402317963, 2.3416142523444385,
+    2.3381565313464456, 2.3347164386943677, 2.3312937405655796,
+    2.327888207732645, 2.3244996154418547, 2.3211277432957731,
+    2.317772375139636, 2.3144332989514456, 2.3111103067356207,
+    2.3078031944200648, 2.3045117617565194, 2.3012358122240766,
+    2.2979751529357335, 2.2947295945478703, 2.2914989511725454,
+    2.2882830402925003, 2.285081682678777, 2.2818947023108471,
+    2.2787219262991671, 2.2755631848100641, 2.2724183109928759,
+    2.2692871409092588, 2.2661695134645852, 2.263065270341365,
+    2.2599742559346088, 2.2568963172890708, 2.2538313040383078,
+    2.2507790683454854, 2.2477394648458757, 2.2447123505909876,
+    2.2416975849942746, 2.2386950297783641, 2.2357045489237608,
+    2.2327260086189735, 2.2297592772120165, 2.2268042251632405,
+    2.2238607249994531, 2.2209286512692805, 2.2180078804997354,
+    2.2150982911539492, 2.2121997635900312, 2.2093121800210214,
+    2.2064354244758966, 2.2035693827616041, 2.2007139424260833,
+    2.197868992722249, 2.1950344245729045, 2.1922101305365569,
+    2.1893960047741041, 2.1865919430163712, 2.1837978425324658,
+    2.1810136020989312, 2.1782391219696708, 2.1754743038466211,
+    2.172719050851152, 2.1699732674961725, 2.1672368596589182,
+    2.1645097345544055, 2.1617918007095298, 2.1590829679377874,
+    2.1563831473146076, 2.1536922511532737, 2.1510101929814165,
+    2.1483368875180671, 2.1456722506512467, 2.1430161994160857,
+    2.1403686519734522, 2.1377295275890766, 2.1350987466131586,
+    2.1324762304604459, 2.1298619015907656, 2.1272556834900023,
+    2.1246575006515065, 2.1220672785579229, 2.1194849436634278,
+    2.1169104233763627, 2.1143436460422556, 2.1117845409272191,
+    2.1092330382017139, 2.1066890689246693, 2.1041525650279511,
+    2.1016234593011673, 2.0991016853768039, 2.0965871777156795,
+    2.0940798715927151, 2.0915797030830063, 2.0890866090481919,
+    2.0866005271231125, 2.0841213957027493, 2.0816491539294399,
+    2.0791837416803571, 2.0767250995552535, 2.0742731688644569,
+    2.0718278916171151, 2.0693892105096805, 2.0669570689146335,
+    2.0645314108694337, 2.0621121810656957, 2.0596993248385842,
+    2.0572927881564218, 2.0548925176105057, 2.0524984604051286,
+    2.0501105643477957, 2.0477287778396369, 2.0453530498660086,
+    2.0429833299872784, 2.0406195683297912, 2.0382617155770117,
+    2.0359097229608358, 2.033563542253074, 2.0312231257570956,
+    2.0288884262996345, 2.02655939722275, 2.0242359923759428,
+    2.0219181661084171, 2.0196058732614919, 2.0172990691611523,
+    2.0149977096107414, 2.0127017508837883, 2.0104111497169685,
+    2.0081258633031958, 2.0058458492848401, 2.0035710657470709,
+    2.0013014712113208, 1.9990370246288698, 1.9967776853745447,
+    1.9945234132405332, 1.9922741684303085, 1.990029911552663,
+    1.9877906036158495, 1.9855562060218253, 1.9833266805605994,
+    1.9811019894046789, 1.9788820951036135, 1.9766669605786344,
+    1.9744565491173893, 1.9722508243687662, 1.9700497503378092,
+    1.9678532913807205, 1.9656614121999496, 1.9634740778393647,
+    1.9612912536795095, 1.9591129054329384, 1.9569389991396309,
+    1.9547695011624848, 1.9526043781828843, 1.9504435971963427,
+    1.9482871255082175, 1.9461349307294966, 1.9439869807726557,
+    1.9418432438475832, 1.9397036884575718, 1.9375682833953767,
+    1.9354369977393377, 1.9333098008495655, 1.9311866623641876,
+    1.9290675521956577, 1.9269524405271223, 1.9248412978088476,
+    1.9227340947547014, 1.9206308023386931, 1.9185313917915678,
+    1.9164358345974541, 1.9143441024905647, 1.9122561674519496,
+    1.9101720017063002, 1.9080915777188017, 1.9060148681920366,
+    1.9039418460629345, 1.9018724844997705, 1.8998067568992081,
+    1.8977446368833888, 1.8956860982970656, 1.8936311152047807,
+    1.8915796618880849, 1.8895317128428009, 1.8874872427763252,
+    1.8854462266049732, 1.8834086394513629, 1.8813744566418371,
+    1.8793436537039243, 1.877316206363838, 1.8752920905440118,
+    1.8732712823606714, 1.8712537581214419, 1.8692394943229902,
+    1.8672284676487014, 1.8652206549663899, 1.8632160333260421,
+    1.8612145799575928, 1.8592162722687329, 1.8572210878427489,
+    1.8552290044363928, 1.8532399999777824, 1.8512540525643313,
+    1.8492711404607087, 1.8472912420968266, 1.8453143360658566,
+    1.8433404011222732, 1.841369416179925, 1.8394013603101329,
+    1.8374362127398141, 1.8354739528496311, 1.8335145601721683,
+    1.8315580143901316, 1.829604295334573, 1.8276533829831396,
+    1.8257052574583466, 1.8237598990258723, 1.8218172880928776,
+    1.8198774052063467, 1.8179402310514505, 1.8160057464499324,
+    1.8140739323585138, 1.8121447698673221, 1.8102182401983391,
+    1.808294324703869, 1.8063730048650273, 1.8044542622902486,
+    1.8025380787138148, 1.800624435994401, 1.7987133161136408,
+    1.7968047011747099, 1.794898573400928, 1.7929949151343785,
+    1.7910937088345449, 1.7891949370769651, 1.7872985825519032,
+    1.7854046280630367, 1.7835130565261608, 1.7816238509679088,
+    1.7797369945244883, 1.7778524704404333, 1.7759702620673705,
+    1.7740903528628025, 1.7722127263889043, 1.7703373663113353,
+    1.7684642563980657, 1.7665933805182163, 1.7647247226409133,
+    1.7628582668341557, 1.7609939972636972, 1.7591318981919415,
+    1.7572719539768487, 1.7554141490708572, 1.7535584680198173,
+    1.7517048954619354, 1.7498534161267341, 1.748004014834021,
+    1.746156676492872, 1.7443113861006236, 1.7424681287418802,
+    1.7406268895875285, 1.7387876538937672, 1.7369504070011448,
+    1.7351151343336095, 1.7332818213975698, 1.731450453780965,
+    1.7296210171523458, 1.7277934972599669, 1.7259678799308866,
+    1.7241441510700792, 1.7223222966595557, 1.7205023027574933,
+    1.718684155497376, 1.7168678410871434, 1.7150533458083488,
+    1.7132406560153264, 1.7114297581343674, 1.709620638662904,
+    1.7078132841687037, 1.7060076812890703, 1.7042038167300537,
+    1.7024016772656687, 1.7006012497371206, 1.6988025210520397,
+    1.6970054781837232, 1.695210108170385, 1.6934163981144126,
+    1.6916243351816318, 1.6898339066005788, 1.6880450996617795,
+    1.6862579017170363, 1.6844723001787205, 1.6826882825190734,
+    1.6809058362695128, 1.6791249490199474, 1.6773456084180967,
+    1.6755678021688176, 1.6737915180334384, 1.6720167438290976,
+    1.6702434674280902, 1.6684716767572192, 1.6667013597971534,
+    1.6649325045817911, 1.6631650991976299, 1.6613991317831418,
+    1.659634590528154, 1.6578714636732357, 1.6561097395090898,
+    1.6543494063759501, 1.6525904526629844, 1.6508328668077019,
+    1.649076637295366, 1.647321752658413, 1.6455682014758746,
+    1.6438159723728061, 1.6420650540197184, 1.6403154351320162,
+    1.6385671044694399, 1.6368200508355124, 1.6350742630769897,
+    1.6333297300833174, 1.6315864407860903, 1.6298443841585166,
+    1.6281035492148868, 1.6263639250100461, 1.6246255006388717,
+    1.6228882652357535, 1.6211522079740781, 1.6194173180657188,
+    1.6176835847605271, 1.6159509973458299, 1.6142195451459291,
+    1.612489217521605, 1.6107600038696237, 1.6090318936222479,
+    1.6073048762467514, 1.6055789412449366, 1.6038540781526549,
+    1.6021302765393315, 1.600407526007493, 1.5986858161922974,
+    1.5969651367610684, 1.595245477412832, 1.593526827877856,
+    1.5918091779171937, 1.5900925173222282, 1.5883768359142216,
+    1.5866621235438665, 1.5849483700908393, 1.5832355654633574,
+    1.5815236995977384, 1.5798127624579617, 1.5781027440352324,
+    1.5763936343475504, 1.5746854234392766, 1.5729781013807069,
+    1.5712716582676451, 1.5695660842209798, 1.567861369386262,
+    1.5661575039332869, 1.5644544780556762, 1.5627522819704625,
+    1.5610509059176774, 1.5593503401599396, 1.5576505749820462,
+    1.5559516006905656, 1.5542534076134318, 1.5525559860995415,
+    1.5508593265183517, 1.5491634192594805, 1.5474682547323084,
+    1.5457738233655813, 1.5440801156070161, 1.5423871219229068,
+    1.540694832797733, 1.5390032387337687, 1.5373123302506937,
+    1.535622097885206, 1.5339325321906354, 1.5322436237365584,
+    1.5305553631084143, 1.528867740907123, 1.5271807477487029,
+    1.5254943742638924, 1.5238086110977687, 1.5221234489093713,
+    1.5204388783713245, 1.518754890169461, 1.5170714750024472,
+    1.5153886235814094, 1.5137063266295594, 1.5120245748818235,
+    1.5103433590844693, 1.5086626699947356, 1.5069824983804621,
+    1.5053028350197197, 1.5036236707004416, 1.5019449962200546,
+    1.500266802385112, 1.4985890800109256, 1.4969118199211993,
+    1.4952350129476626, 1.4935586499297049, 1.4918827217140092,
+    1.4902072191541877, 1.4885321331104162, 1.4868574544490694,
+    1.4851831740423562, 1.4835092827679561, 1.4818357715086541,
+    1.4801626311519769, 1.4784898525898285, 1.4768174267181264,
+    1.4751453444364375, 1.4734735966476138, 1.4718021742574277,
+    1.4701310681742086, 1.4684602693084776, 1.4667897685725828,
+    1.4651195568803339, 1.4634496251466371, 1.4617799642871299,
+    1.4601105652178143, 1.4584414188546904, 1.4567725161133895,
+    1.4551038479088074, 1.4534354051547353, 1.4517671787634918,
+    1.4500991596455537, 1.4484313387091863, 1.4467637068600723,
+    1.4450962550009416, 1.4434289740311985, 1.4417618548465494,
+    1.4400948883386282, 1.4384280653946222, 1.4367613768968974,
+    1.4350948137226203, 1.433428366743382, 1.431762026824819,
+    1.4300957848262326, 1.428429631600209, 1.4267635579922369,
+    1.4250975548403246, 1.4234316129746147, 1.4217657232169987,
+    1.4200998763807289, 1.4184340632700307, 1.4167682746797119,
+    1.4151025013947707, 1.4134367341900029, 1.4117709638296065,
+    1.4101051810667855, 1.4084393766433516, 1.4067735412893243,
+    1.4051076657225288, 1.4034417406481927, 1.4017757567585403,
+    1.4001097047323852, 1.3984435752347204, 1.3967773589163075,
+    1.3951110464132626, 1.3934446283466404, 1.3917780953220171,
+    1.3901114379290689, 1.3884446467411502, 1.386777712314869,
+    1.3851106251896588, 1.3834433758873492, 1.3817759549117341,
+    1.3801083527481357, 1.3784405598629679, 1.3767725667032957,
+    1.3751043636963924, 1.3734359412492931, 1.3717672897483471,
+    1.3700983995587652, 1.3684292610241664, 1.3667598644661183,
+    1.3650902001836782, 1.363420258452928, 1.3617500295265075,
+    1.3600795036331432, 1.358408670977175, 1.3567375217380784,
+    1.3550660460699839, 1.3533942341011924, 1.3517220759336865,
+    1.3500495616426393, 1.3483766812759186, 1.3467034248535872,
+    1.3450297823673991, 1.343355743780293, 1.3416812990258791,
+    1.3400064380079244, 1.3383311505998325, 1.3366554266441193,
+    1.3349792559518834, 1.333302628302274, 1.3316255334419524,
+    1.3299479610845493, 1.3282699009101178, 1.3265913425645812,
+    1.3249122756591762, 1.3232326897698907, 1.3215525744368966,
+    1.3198719191639774, 1.3181907134179509, 1.3165089466280862,
+    1.3148266081855149, 1.3131436874426372, 1.3114601737125227,
+    1.3097760562683038, 1.3080913243425656, 1.3064059671267274,
+    1.3047199737704205, 1.3030333333808573, 1.3013460350221961,
+    1.2996580677148992, 1.2979694204350829, 1.2962800821138627,
+    1.2945900416366907, 1.2928992878426868, 1.2912078095239623,
+    1.2895155954249364, 1.2878226342416461, 1.2861289146210482,
+    1.2844344251603133, 1.2827391544061135, 1.281043090853901,
+    1.2793462229471797, 1.2776485390767685, 1.2759500275800555,
+    1.2742506767402453, 1.2725504747855976, 1.2708494098886558,
+    1.2691474701654686, 1.2674446436748013, 1.2657409184173383,
+    1.2640362823348774, 1.2623307233095138, 1.2606242291628134,
+    1.2589167876549787, 1.2572083864840036, 1.2554990132848169,
+    1.2537886556284186, 1.2520773010210018, 1.2503649369030674,
+    1.2486515506485261, 1.2469371295637897, 1.2452216608868514,
+    1.2435051317863548, 1.2417875293606506, 1.2400688406368421,
+    1.2383490525698182, 1.236628152041275, 1.2349061258587235,
+    1.2331829607544855, 1.2314586433846768, 1.2297331603281763,
+    1.2280064980855825, 1.226278643078156, 1.224549581646748,
+    1.2228193000507146, 1.2210877844668171, 1.2193550209881074,
+    1.2176209956227981, 1.2158856942931178, 1.2141491028341505,
+    1.2124112069926594, 1.2106719924258955, 1.2089314447003878,
+    1.2071895492907188, 1.2054462915782811, 1.2037016568500194,
+    1.2019556302971515, 1.2002081970138743, 1.198459341996049,
+    1.1967090501398703, 1.1949573062405139, 1.1932040949907665,
+    1.1914494009796353, 1.1896932086909375, 1.1879355025018694,
+    1.1861762666815547, 1.1844154853895712, 1.1826531426744555,
+    1.1808892224721874, 1.1791237086046493, 1.1773565847780638,
+    1.1755878345814088, 1.1738174414848064, 1.1720453888378897,
+    1.1702716598681442, 1.1684962376792227, 1.1667191052492361,
+    1.1649402454290165, 1.1631596409403546, 1.1613772743742081,
+    1.1595931281888852, 1.1578071847081952, 1.1560194261195753,
+    1.1542298344721829, 1.1524383916749603, 1.150645079494669,
+    1.1488498795538897, 1.1470527733289946, 1.1452537421480824,
+    1.143452767188883, 1.1416498294766264, 1.1398449098818779,
+    1.1380379891183368, 1.1362290477405992, 1.1344180661418848,
+    1.1326050245517232, 1.1307899030336046, 1.1289726814825896,
+    1.127153339622879, 1.1253318570053417, 1.123508213005002,
+    1.1216823868184838, 1.1198543574614095, 1.1180241037657563,
+    1.1161916043771654, 1.1143568377522046, 1.1125197821555843,
+    1.1106804156573233, 1.1088387161298656, 1.1069946612451467,
+    1.1051482284716065, 1.1032993950711509, 1.1014481380960575,
+    1.0995944343858264, 1.0977382605639738, 1.0958795930347689,
+    1.0940184079799091, 1.0921546813551366, 1.0902883888867918,
+    1.0884195060683033, 1.0865480081566137, 1.0846738701685374,
+    1.0827970668770519, 1.0809175728075187, 1.0790353622338336,
+    1.0771504091745037, 1.0752626873886497, 1.0733721703719323,
+    1.0714788313524013, 1.0695826432862623, 1.0676835788535639,
+    1.0657816104538003, 1.0638767102014279, 1.0619688499212947,
+    1.060058001143978, 1.0581441351010319, 1.0562272227201392,
+    1.0543072346201672, 1.0523841411061228, 1.0504579121640085,
+    1.0485285174555727, 1.046595926312953, 1.0446601077332109,
+    1.0427210303727543, 1.0407786625416446, 1.0388329721977865,
+    1.0368839269409957, 1.0349314940069452, 1.0329756402609809,
+    1.03101633219181, 1.0290535359050534, 1.0270872171166623,
+    1.025117341146192, 1.0231438729099336, 1.0211667769138952,
+    1.0191860172466316, 1.017201557571918, 1.0152133611212619,
+    1.0132213906862508, 1.0112256086107312, 1.009225976782812,
+    1.007222456626691, 1.0052150090942957, 1.0032035946567379,
+    1.0011881732955719, 0.99916870449385542, 0.99714514722700431,
+    0.99511745995343692, 0.99308560060500295, 0.99104952657718814,
+    0.98900919471909088, 0.98696456132316268, 0.98491558211470631,
+    0.98286221224112502, 0.98080440626091459, 0.97874211813239154,
+    0.97667530120214874, 0.9746039081932325, 0.9725278911930294,
+    0.9704472016408584, 0.96836179031525527, 0.96627160732094342,
+    0.96417660207547939, 0.96207672329556426, 0.95997191898301026,
+    0.95786213641035223, 0.9557473221060927, 0.95362742183956872,
+    0.95150238060543035, 0.94937214260771607, 0.94723665124351486,
+    0.94509584908619937, 0.94294967786821804, 0.94079807846343289,
+    0.93864099086898467, 0.93647835418667369, 0.93431010660383929,
+    0.93213618537372001, 0.92995652679527929, 0.92777106619247796,
+    0.92557973789297465, 0.9233824752062354, 0.92117921040103257,
+    0.91896987468231084, 0.91675439816740112, 0.91453270986155677,
+    0.9123047376327913, 0.91007040818599116, 0.90782964703627955,
+    0.90558237848160306, 0.90332852557451593, 0.90106801009313053,
+    0.89880075251120517, 0.89652667196733904, 0.89424568623323908,
+    0.89195771168102678, 0.88966266324954846, 0.8873604544096525,
+    0.88505099712839375, 0.88273420183212603, 0.88040997736843818,
+    0.87807823096689253, 0.87573886819851732, 0.87339179293400482,
+    0.87103690730056671, 0.86867411163739039, 0.86630330444964454,
+    0.8639243823609738, 0.86153724006442145, 0.85914177027171945,
+    0.85673786366087612, 0.85432540882199226, 0.85190429220123565,
+    0.84947439804289149, 0.84703560832941371, 0.84458780271938927,
+    0.84213085848332792, 0.83966465043718408, 0.83718905087351203,
+    0.83470392949015237, 0.83220915331634104, 0.82970458663612678,
+    0.82719009090897688, 0.82466552468744625, 0.82213074353177351,
+    0.819585599921269, 0.81702994316234179, 0.81446361929301325,
+    0.81188647098375144, 0.80929833743445334, 0.80669905426739097,
+    0.80408845341592894, 0.80146636300880791, 0.79883260724977789,
+    0.79618700629235362, 0.79352937610944718, 0.79085952835762552,
+    0.78817727023571682, 0.78548240433748084, 0.78277472849803775,
+    0.78005403563372822, 0.77732011357506503, 0.77457274489240913,
+    0.77181170671397958, 0.76903677053578989, 0.76624770202306469,
+    0.76344426080267513, 0.76062620024609084, 0.75779326724231977,
+    0.75494520196026793, 0.75208173759991581, 0.74920260013166584,
+    0.74630750802317136, 0.74339617195290886, 0.74046829450970597,
+    0.73752356987737944, 0.73456168350357764, 0.73158231175185817,
+    0.72858512153595678, 0.725569769935132, 0.72253590378938126,
+    0.71948315927323625, 0.71641116144674633, 0.7133195237821498,
+    0.71020784766461775, 0.70707572186532541, 0.70392272198496686,
+    0.70074840986567766, 0.69755233296915953, 0.69433402371862241,
+    0.69109299880195507, 0.68782875843331703, 0.68454078557010056,
+    0.68122854508194841, 0.67789148286821277, 0.67452902491992572,
+    0.67114057632198465, 0.66772552019086706, 0.66428321654274569,
+    0.6608130010863934, 0.65731418393472252, 0.65378604822820574,
+    0.65022784866275629, 0.6466388099138981, 0.64301812494822141,
+    0.63936495321218878, 0.63567841868730801, 0.63195760779951426,
+    0.62820156716927955, 0.62440930118748217, 0.62057976940038062,
+    0.61671188368513874, 0.61280450519518426, 0.60885644105223713,
+    0.60486644075904883, 0.60083319230370946, 0.59675531792273873,
+    0.59263136948599393, 0.58845982346163961, 0.58423907541387865,
+    0.57996743397976946, 0.57564311426403858, 0.57126423058220743,
+    0.56682878847232332, 0.56233467588387209, 0.55777965343870706,
+    0.55316134364266401, 0.54847721890743539, 0.54372458821964931,
+    0.53890058226717152, 0.53400213680048481, 0.52902597396840945,
+    0.52396858132093072, 0.5188261881156051, 0.5135947384955406,
+    0.50826986102319927, 0.50284683395132501, 0.49732054548499144,
+    0.49168544813040416, 0.48593550602782271, 0.48006413391604252,
+    0.47406412605856779, 0.46792757305562604, 0.46164576394247508,
+    0.45520907029297453, 0.4486068081522, 0.44182707243408204,
+    0.43485653682675951, 0.42768021008591994, 0.42028113662400124,
+    0.41264002516044218, 0.40473478333662016, 0.39653992776709052,
+    0.38802582664590035, 0.3791577135611876, 0.36989438294123361,
+    0.3601864332978349, 0.34997385305139384, 0.33918262481452721,
+    0.32771981845012044, 0.31546627221621082, 0.30226525688861189,
+    0.28790409666298339, 0.27208263356286405, 0.25435506476954817,
+    0.2340119089918028, 0.20980625468000494, 0.17917593134837095,
+    0.13506355863508562, 0
+};
+
+CONSTANT
+double y_1024_d[1024] = {
+    0.94510390554914381, 0.9547279056926633, 0.97059404762430868,
+    0.97776856336121665, 0.98192535418074633, 0.98466035574077859,
+    0.98660676832869554, 0.98806808757114051, 0.98920871442048408,
+    0.99012574755984206, 0.99088036570101878, 0.99151310351456845,
+    0.99205192187768654, 0.99251675606398604, 0.99292221702046535,
+    0.99327926701102109, 0.99359629786001447, 0.99387984688246889,
+    0.99413508532445216, 0.99436615960179797, 0.99457643474190027,
+    0.99476867131773072, 0.99494515620250301, 0.99510780065663429,
+    0.99525821491347832, 0.99539776559853854, 0.99552762043405296,
+    0.99564878340593377, 0.99576212269227182, 0.99586839303898556,
+    0.99596825383312015, 0.9960622838118246, 0.99615099311786059,
+    0.9962348332455091, 0.99631420529668546, 0.99638946687403029,
+    0.99646093786730072, 0.99652890533562266, 0.99659362764676807,
+    0.99665533800253603, 0.9967142474542422, 0.99677054749262073,
+    0.99682441228083352, 0.99687600058687109, 0.99692545746168304,
+    0.99697291570136548, 0.9970184971252577, 0.99706231369652598,
+    0.99710446850750289, 0.9971450566485206, 0.99718416597605319,
+    0.99722187779357396, 0.99725826745652468, 0.99729340491112251,
+    0.99732735517532278, 0.99736017876908456, 0.99739193210008736,
+    0.99742266781020861, 0.99745243508735981, 0.99748127994666891,
+    0.99750924548448372, 0.99753637210822066, 0.9975626977447114,
+    0.9975882580293628, 0.99761308647817015, 0.99763721464437827,
+    0.99766067226136823, 0.99768348737317192, 0.99770568645384816,
+    0.9977272945168183, 0.99774833521514006, 0.99776883093358248,
+    0.99778880287327976, 0.99780827112965642, 0.99782725476423684,
+    0.99784577187090107, 0.9978638396370777, 0.99788147440032471,
+    0.99789869170069878, 0.99791550632927795, 0.99793193237316069,
+    0.99794798325724221, 0.99796367178303147, 0.99797901016475288,
+    0.99799401006295474, 0.99800868261581965, 0.99802303846836193,
+    0.99803708779967715, 0.99805084034839253, 0.99806430543645785,
+    0.99807749199140139, 0.99809040856716447, 0.99810306336362287,
+    0.99811546424488762, 0.99812761875647726, 0.99813953414143763,
+    0.9981512173554894, 0.9981626750812671, 0.99817391374171438,
+    0.9981849395126946, 0.99819575833486796, 0.99820637592488637,
+    0.99821679778595085, 0.99822702921777307, 0.99823707532598127,
+    0.99824694103100631, 0.99825663107647933, 0.99826615003717556,
+    0.99827550232652928, 0.99828469220374938, 0.99829372378055925,
+    0.99830260102758239, 0.99831132778040033, 0.99831990774529522,
+    0.9983283445047022, 0.99833664152238655, 0.9983448021483603,
+    0.99835282962355543, 0.99836072708426815, 0.99836849756638313,
+    0.99837614400939756, 0.99838366926024913, 0.99839107607696143,
+    0.99839836713212005, 0.99840554501618239, 0.99841261224063682,
+    0.99841957124101399, 0.99842642437976159, 0.99843317394898801,
+    0.99843982217308269, 0.99844637121122015, 0.99845282315975181,
+    0.99845918005449263, 0.99846544387290947, 0.99847161653621253,
+    0.99847769991135804, 0.9984836958129657, 0.99848960600515335,
+    0.99849543220329606, 0.9985011760757101, 0.9985068392452694,
+    0.99851242329095269, 0.99851792974932918, 0.99852336011598364,
+    0.99852871584688263, 0.99853399835968848, 0.99853920903501914,
+    0.99854434921765811, 0.99854942021771831, 0.99855442331175925,
+    0.99855935974386212, 0.99856423072666201, 0.99856903744234216,
+    0.99857378104359007, 0.99857846265451655, 0.99858308337154211,
+    0.99858764426424851, 0.9985921463762002, 0.99859659072573459,
+    0.99860097830672467, 0.99860531008931208, 0.99860958702061631,
+    0.99861381002541494, 0.99861798000680402, 0.9986220978468312,
+    0.99862616440710783, 0.99863018052940167, 0.99863414703620546,
+    0.99863806473128824, 0.99864193440022775, 0.99864575681092305,
+    0.99864953271409085, 0.99865326284374523, 0.99865694791766113,
+    0.99866058863782103, 0.99866418569084892, 0.99866773974842915,
+    0.99867125146771052, 0.998674721491698, 0.99867815044963293,
+    0.99868153895735834, 0.99868488761767482, 0.9986881970206839,
+    0.99869146774412076, 0.99869470035367702, 0.99869789540331166,
+    0.99870105343555504, 0.99870417498180053, 0.99870726056258907,
+    0.9987103106878843, 0.99871332585733952, 0.99871630656055588,
+    0.9987192532773338, 0.9987221664779159, 0.99872504662322326,
+    0.99872789416508434, 0.99873070954645715, 0.99873349320164462,
+    0.99873624555650498, 0.99873896702865295, 0.99874165802765935,
+    0.99874431895524129, 0.99874695020544846, 0.99874955216484407,
+    0.99875212521268086, 0.99875466972107041, 0.99875718605515107,
+    0.99875967457324688, 0.99876213562702554, 0.99876456956165105,
+    0.99876697671593062, 0.99876935742245887, 0.99877171200775949,
+    0.99877404079241916, 0.99877634409122173, 0.99877862221327662,
+    0.99878087546214422, 0.99878310413595839, 0.99878530852754488,
+    0.99878748892453684, 0.99878964560948891, 0.99879177885998494,
+    0.99879388894874621, 0.99879597614373494, 0.99879804070825529,
+    0.99880008290105304, 0.99880210297641059, 0.99880410118424168,
+    0.99880607777018204, 0.99880803297567877, 0.99880996703807701,
+    0.99881188019070366, 0.9988137726629519, 0.99881564468035888,
+    0.99881749646468643, 0.998819328233996, 0.99882114020272439,
+    0.99882293258175459, 0.99882470557848901, 0.9988264593969175,
+    0.99882819423768454, 0.99882991029815626, 0.99883160777248348,
+    0.99883328685166539, 0.99883494772361092, 0.99883659057319751,
+    0.99883821558233055, 0.99883982293000018, 0.99884141279233651,
+    0.99884298534266458, 0.99884454075155749, 0.99884607918688695,
+    0.99884760081387614, 0.99884910579514752, 0.99885059429077205,
+    0.9988520664583157, 0.99885352245288672, 0.99885496242717975,
+    0.99885638653152031, 0.99885779491390847, 0.99885918772005988,
+    0.99886056509344789, 0.99886192717534328, 0.99886327410485432,
+    0.99886460601896476, 0.99886592305257138, 0.99886722533852135,
+    0.99886851300764778, 0.99886978618880529, 0.99887104500890456,
+    0.99887228959294572, 0.99887352006405139, 0.99887473654349934,
+    0.99887593915075368, 0.99887712800349637, 0.99887830321765669,
+    0.99887946490744151, 0.99888061318536359, 0.99888174816227104,
+    0.99888286994737407, 0.99888397864827283, 0.99888507437098373,
+    0.99888615721996588, 0.9988872272981455, 0.99888828470694291,
+    0.99888932954629539, 0.99889036191468139, 0.99889138190914495,
+    0.99889238962531757, 0.99889338515744164, 0.99889436859839209,
+    0.99889534003969793, 0.99889629957156378, 0.99889724728289053,
+    0.99889818326129554, 0.99889910759313283, 0.99890002036351255,
+    0.99890092165632005, 0.99890181155423463, 0.99890269013874833,
+    0.99890355749018334, 0.99890441368771032, 0.9989052588093652,
+    0.99890609293206678, 0.99890691613163296, 0.99890772848279707,
+    0.99890853005922386, 0.99890932093352558, 0.99891010117727763,
+    0.99891087086103236, 0.99891163005433525, 0.99891237882573891,
+    0.99891311724281751, 0.99891384537218031, 0.9989145632794858,
+    0.99891527102945532, 0.99891596868588584, 0.99891665631166293,
+    0.99891733396877402, 0.99891800171832001, 0.99891865962052817,
+    0.99891930773476412, 0.99891994611954293, 0.99892057483254149,
+    0.99892119393060952, 0.99892180346978054, 0.99892240350528316,
+    0.99892299409155139, 0.99892357528223541, 0.99892414713021183,
+    0.99892470968759395, 0.99892526300574136, 0.99892580713527002,
+    0.99892634212606191, 0.99892686802727404, 0.998927384887348,
+    0.99892789275401894, 0.99892839167432446, 0.99892888169461347,
+    0.99892936286055445, 0.99892983521714418, 0.99893029880871576,
+    0.99893075367894713, 0.99893119987086842, 0.99893163742687052,
+    0.99893206638871179, 0.99893248679752666, 0.99893289869383251,
+    0.99893330211753673, 0.998933697107944, 0.99893408370376369,
+    0.99893446194311641, 0.9989348318635406, 0.99893519350199955,
+    0.99893554689488739, 0.99893589207803646, 0.9989362290867223,
+    0.99893655795567082, 0.99893687871906389, 0.99893719141054538,
+    0.99893749606322724, 0.99893779270969452, 0.99893808138201201,
+    0.99893836211172904, 0.99893863492988488, 0.99893889986701456,
+    0.99893915695315372, 0.99893940621784416, 0.99893964769013799,
+    0.99893988139860346, 0.99894010737132988, 0.99894032563593127,
+    0.99894053621955259, 0.99894073914887305, 0.99894093445011112,
+    0.9989411221490293, 0.99894130227093791, 0.99894147484069939,
+    0.99894163988273299, 0.9989417974210183, 0.9989419474790997,
+    0.99894209008009027, 0.99894222524667509, 0.998942353001116,
+    0.99894247336525444, 0.99894258636051625, 0.99894269200791341,
+    0.99894279032804967, 0.99894288134112275, 0.99894296506692759,
+    0.9989430415248608, 0.99894311073392272, 0.99894317271272148,
+    0.99894322747947528, 0.99894327505201697, 0.99894331544779469,
+    0.99894334868387724, 0.99894337477695561, 0.99894339374334595,
+    0.99894340559899286, 0.99894341035947165, 0.99894340803999082,
+    0.99894339865539572, 0.99894338222016954, 0.9989433587484372,
+    0.99894332825396714, 0.99894329075017363, 0.99894324625011932,
+    0.99894319476651783, 0.99894313631173515, 0.998943070897793,
+    0.99894299853636981, 0.9989429192388033, 0.9989428330160931,
+    0.99894273987890181, 0.99894263983755716, 0.99894253290205459,
+    0.99894241908205827, 0.99894229838690352, 0.998942170825598,
+    0.99894203640682422, 0.99894189513894038, 0.99894174702998262,
+    0.99894159208766597, 0.99894143031938698, 0.99894126173222431,
+    0.99894108633294021, 0.99894090412798253, 0.99894071512348548,
+    0.99894051932527173, 0.99894031673885308, 0.9989401073694314,
+    0.99893989122190097, 0.99893966830084913, 0.9989394386105569,
+    0.9989392021550012, 0.99893895893785467, 0.99893870896248771,
+    0.99893845223196887, 0.99893818874906648, 0.99893791851624847,
+    0.99893764153568454, 0.9989373578092462, 0.99893706733850773,
+    0.99893677012474724, 0.99893646616894682, 0.99893615547179404,
+    0.99893583803368213, 0.9989355138547108, 0.99893518293468664,
+    0.99893484527312371, 0.9989345008692444, 0.9989341497219798,
+    0.99893379182997011, 0.99893342719156475, 0.99893305580482361,
+    0.99893267766751659, 0.99893229277712414, 0.99893190113083796,
+    0.99893150272556097, 0.99893109755790743, 0.99893068562420384,
+    0.99893026692048748, 0.99892984144250874, 0.99892940918572959,
+    0.99892897014532445, 0.99892852431617996, 0.99892807169289499,
+    0.99892761226978055, 0.99892714604085997, 0.99892667299986915,
+    0.99892619314025533, 0.99892570645517798, 0.99892521293750802,
+    0.99892471257982862, 0.99892420537443316, 0.99892369131332681,
+    0.99892317038822509, 0.99892264259055397, 0.99892210791144964,
+    0.99892156634175733, 0.9989210178720318, 0.99892046249253674,
+    0.99891990019324373, 0.99891933096383212, 0.99891875479368863,
+    0.99891817167190611, 0.99891758158728339, 0.99891698452832556,
+    0.99891638048324094, 0.99891576943994265, 0.9989151513860467,
+    0.99891452630887145, 0.99891389419543686, 0.99891325503246375,
+    0.99891260880637245, 0.99891195550328238, 0.99891129510901122,
+    0.99891062760907334, 0.99890995298867924, 0.99890927123273454,
+    0.99890858232583835, 0.99890788625228322, 0.99890718299605263,
+    0.99890647254082132, 0.9989057548699527, 0.99890502996649833,
+    0.99890429781319656, 0.99890355839247136, 0.99890281168643058,
+    0.9989020576768648, 0.99890129634524605, 0.99890052767272597,
+    0.998899751640135, 0.99889896822797997, 0.99889817741644304,
+    0.99889737918538013, 0.99889657351431915, 0.99889576038245864,
+    0.99889493976866528, 0.99889411165147357, 0.99889327600908207,
+    0.99889243281935314, 0.99889158205981088, 0.99889072370763865,
+    0.99888985773967731, 0.99888898413242377, 0.99888810286202812,
+    0.99888721390429236, 0.99888631723466759, 0.99888541282825283,
+    0.99888450065979173, 0.998883580703671, 0.99888265293391831,
+    0.99888171732419917, 0.99888077384781548, 0.99887982247770279,
+    0.99887886318642782, 0.99887789594618559, 0.99887692072879797,
+    0.99887593750570991, 0.99887494624798767, 0.99887394692631548,
+    0.99887293951099365, 0.99887192397193525, 0.99887090027866332,
+    0.99886986840030778, 0.99886882830560353, 0.99886777996288634,
+    0.99886672334009063, 0.99886565840474584, 0.99886458512397414,
+    0.99886350346448638, 0.9988624133925792, 0.99886131487413199,
+    0.99886020787460339, 0.99885909235902814, 0.99885796829201334,
+    0.99885683563773475, 0.99885569435993427, 0.99885454442191557,
+    0.99885338578654037, 0.99885221841622474, 0.99885104227293608,
+    0.99884985731818843, 0.9988486635130388, 0.99884746081808373,
+    0.99884624919345455, 0.99884502859881408, 0.99884379899335141,
+    0.99884256033577834, 0.99884131258432618, 0.99884005569673884,
+    0.99883878963027151, 0.99883751434168366, 0.99883622978723519,
+    0.99883493592268291, 0.99883363270327452, 0.9988323200837449,
+    0.99883099801830999, 0.99882966646066351, 0.99882832536397026,
+    0.9988269746808629, 0.99882561436343498, 0.99882424436323736,
+    0.99882286463127168, 0.99882147511798536, 0.99882007577326681,
+    0.99881866654643903, 0.99881724738625433, 0.9988158182408885,
+    0.99881437905793546, 0.99881292978440062, 0.99881147036669571,
+    0.99881000075063175, 0.99880852088141403, 0.99880703070363497,
+    0.99880553016126827, 0.99880401919766226, 0.99880249775553287,
+    0.99880096577695832, 0.99879942320337101, 0.99879786997555109,
+    0.99879630603362002, 0.998794731317033, 0.99879314576457157,
+    0.99879154931433689, 0.99878994190374237, 0.9987883234695053,
+    0.99878669394764008, 0.99878505327345057, 0.99878340138152155,
+    0.99878173820571114, 0.99878006367914207, 0.9987783777341952,
+    0.99877668030249911, 0.99877497131492254, 0.99877325070156586,
+    0.99877151839175216, 0.99876977431401814, 0.99876801839610574,
+    0.99876625056495205, 0.99876447074668051, 0.99876267886659176,
+    0.99876087484915343, 0.99875905861799086, 0.99875723009587647,
+    0.99875538920472107, 0.99875353586556159, 0.9987516699985528,
+    0.9987497915229554, 0.99874790035712602, 0.99874599641850537,
+    0.99874407962360889, 0.9987421498880138, 0.99874020712634803,
+    0.99873825125227977, 0.99873628217850419, 0.99873429981673256,
+    0.99873230407767954, 0.99873029487105069, 0.99872827210553061,
+    0.99872623568876939, 0.9987241855273703, 0.99872212152687589,
+    0.99872004359175526, 0.99871795162539045, 0.99871584553006187,
+    0.9987137252069348, 0.9987115905560453, 0.99870944147628549,
+    0.99870727786538815, 0.99870509961991283, 0.99870290663523009,
+    0.99870069880550549, 0.99869847602368478, 0.9986962381814769,
+    0.99869398516933883, 0.99869171687645764, 0.998689433190735,
+    0.99868713399876918, 0.99868481918583818, 0.99868248863588127,
+    0.99868014223148205, 0.99867777985384898, 0.99867540138279798,
+    0.99867300669673265, 0.99867059567262506, 0.99866816818599613,
+    0.99866572411089694, 0.99866326331988653, 0.9986607856840124,
+    0.99865829107278969, 0.99865577935417893, 0.99865325039456554,
+    0.99865070405873702, 0.99864814020986004, 0.99864555870945892,
+    0.99864295941739134, 0.99864034219182451, 0.9986377068892125,
+    0.99863505336426972, 0.99863238146994748, 0.9986296910574084,
+    0.99862698197599964, 0.99862425407322786, 0.99862150719473186,
+    0.99861874118425487, 0.99861595588361773, 0.99861315113268978,
+    0.99861032676936112, 0.99860748262951238, 0.9986046185469849,
+    0.99860173435355148, 0.99859882987888404, 0.99859590495052364,
+    0.99859295939384674, 0.998589993032034, 0.99858700568603642,
+    0.99858399717454105, 0.99858096731393786, 0.9985779159182826,
+    0.99857484279926301, 0.99857174776616076, 0.99856863062581491,
+    0.99856549118258486, 0.99856232923831001, 0.99855914459227191,
+    0.9985559370411532, 0.99855270637899807, 0.99854945239716864,
+    0.99854617488430486, 0.9985428736262788, 0.99853954840615322,
+    0.99853619900413415, 0.99853282519752673, 0.99852942676068768,
+    0.99852600346497822, 0.99852255507871468, 0.99851908136711998,
+    0.99851558209227242, 0.99851205701305401, 0.99850850588509898,
+    0.99850492846073913, 0.9985013244889489, 0.99849769371529151,
+    0.99849403588185925, 0.9984903507272177, 0.99848663798634607,
+    0.9984828973905755, 0.99847912866752886, 0.99847533154105717,
+    0.99847150573117494, 0.99846765095399492, 0.99846376692166261,
+    0.99845985334228449, 0.99845590991986244, 0.99845193635421892,
+    0.9984479323409261, 0.99844389757123164, 0.99843983173198148,
+    0.99843573450554479, 0.99843160556973243, 0.99842744459771737,
+    0.99842325125795184, 0.99841902521408343, 0.99841476612486835,
+    0.99841047364408375, 0.99840614742043821, 0.9984017870974784,
+    0.99839739231349689, 0.99839296270143563, 0.99838849788878736,
+    0.99838399749749507, 0.9983794611438509, 0.99837488843838995,
+    0.99837027898578379, 0.99836563238473064, 0.99836094822784349,
+    0.99835622610153518, 0.99835146558590171, 0.99834666625460167,
+    0.99834182767473423, 0.99833694940671336, 0.99833203100413936,
+    0.99832707201366777, 0.99832207197487488, 0.9983170304201201,
+    0.99831194687440439, 0.99830682085522826, 0.99830165187244191,
+    0.99829643942809532, 0.99829118301628383, 0.99828588212298885,
+    0.99828053622591717, 0.99827514479433288, 0.99826970728888864,
+    0.99826422316145169, 0.99825869185492444, 0.99825311280306173,
+    0.99824748543028397, 0.99824180915148408, 0.99823608337183278,
+    0.99823030748657382, 0.9982244808808195, 0.99821860292933806,
+    0.9982126729963362, 0.99820669043523658, 0.99820065458844831,
+    0.99819456478713364, 0.998188420350967, 0.99818222058788875,
+    0.9981759647938514, 0.99816965225256082, 0.99816328223521011,
+    0.99815685400020449, 0.99815036679288283, 0.99814381984522771,
+    0.99813721237557151, 0.99813054358829123, 0.99812381267349715,
+    0.99811701880671388, 0.99811016114854922, 0.99810323884435859,
+    0.9980962510238961, 0.99808919680095964, 0.99808207527302273,
+    0.99807488552085966, 0.99806762660815695, 0.99806029758111625,
+    0.99805289746804537, 0.99804542527893692, 0.99803788000503557,
+    0.99803026061839462, 0.99802256607141671, 0.99801479529638371,
+    0.99800694720497152, 0.99799902068775304, 0.997991014613683,
+    0.99798292782957165, 0.99797475915953937, 0.99796650740445736,
+    0.9979581713413721, 0.99794974972290973, 0.9979412412766655,
+    0.99793264470457332, 0.99792395868225559, 0.99791518185835526,
+    0.99790631285384523, 0.99789735026131765, 0.99788829264424972,
+    0.99787913853624988, 0.9978698864402753, 0.99786053482783044,
+    0.99785108213813478, 0.99784152677726845, 0.99783186711728744,
+    0.99782210149531225, 0.99781222821258575, 0.9978022455335015,
+    0.99779215168459945, 0.99778194485352834, 0.99777162318797508,
+    0.99776118479455744, 0.99775062773767986, 0.99773995003835092,
+    0.99772914967296022, 0.99771822457201598, 0.99770717261883513,
+    0.99769599164819256, 0.99768467944492156, 0.99767323374246553,
+    0.99766165222137915, 0.99764993250777789, 0.99763807217173051,
+    0.99762606872559545, 0.99761391962229873, 0.99760162225354621,
+    0.99758917394797564, 0.99757657196923677, 0.99756381351400458,
+    0.99755089570991629, 0.99753781561343369, 0.9975245702076232,
+    0.99751115639985599, 0.9974975710194165, 0.99748381081502269,
+    0.99746987245225105, 0.99745575251085994, 0.99744144748201158,
+    0.99742695376538315, 0.99741226766616575, 0.99739738539194289,
+    0.99738230304944608, 0.997367016641177, 0.99735152206189748,
+    0.99733581509497249, 0.99731989140856492, 0.99730374655167375,
+    0.99728737595000549, 0.99727077490167515, 0.99725393857272415,
+    0.99723686199244821, 0.99721954004852664, 0.99720196748194068,
+    0.9971841388816699, 0.99716604867916192, 0.99714769114255131,
+    0.99712906037062854, 0.99711015028653616, 0.99709095463118158,
+    0.99707146695635229, 0.99705168061751426, 0.99703158876628084,
+    0.99701118434253067, 0.9969904600661581, 0.99696940842843307,
+    0.9969480216829526, 0.99692629183615566, 0.99690421063738488,
+    0.99688176956845909, 0.9968589598327382, 0.99683577234364518,
+    0.99681219771261609, 0.99678822623644292, 0.99676384788397598,
+    0.99673905228214399, 0.9967138287012538, 0.99668816603952537,
+    0.99666205280681186, 0.99663547710746192, 0.99660842662226135,
+    0.99658088858940319, 0.99655284978442404, 0.99652429649903251,
+    0.99649521451877099, 0.99646558909942495, 0.99643540494209737,
+    0.99640464616686875, 0.9963732962849331, 0.99634133816912229,
+    0.99630875402269525, 0.99627552534628105, 0.9962416329028414,
+    0.99620705668051546, 0.9961717758531965, 0.99613576873867538,
+    0.99609901275417412, 0.9960614843690796, 0.99602315905466776,
+    0.99598401123059122, 0.99594401420788925, 0.99590314012824577,
+    0.99586135989921398, 0.99581864312508228, 0.99577495803304072,
+    0.99573027139427006, 0.99568454843953969, 0.99563775276886668,
+    0.99558984625473834, 0.99554078893836051, 0.99549053891833739,
+    0.99543905223112705, 0.9953862827225618, 0.99533218190963846,
+    0.99527669883171044, 0.99521977989012034, 0.99516136867521543,
+    0.9951014057795623, 0.99503982859607532, 0.99497657109960047,
+    0.9949115636103647, 0.99484473253749928, 0.99477600010066036,
+    0.99470528402752556, 0.99463249722469527, 0.99455754741923241,
+    0.99448033676773562, 0.99440076142946199, 0.99431871109958714,
+    0.99423406849818796, 0.99414670880997136, 0.99405649906911742,
+    0.99396329748286749, 0.99386695268661329, 0.99376730292226712,
+    0.99366417513052274, 0.99355738394630499, 0.99344673058513977,
+    0.99333200160637436, 0.99321296753707067, 0.99308938133789915,
+    0.99296097668948502, 0.99282746607417949, 0.99268853862422135,
+    0.99254385770239351, 0.99239305817558576, 0.99223574333480724,
+    0.99207148140699863, 0.99189980159412094, 0.99172018956308072,
+    0.99153208229558698, 0.99133486218943911, 0.99112785028119965,
+    0.99091029843375045, 0.99068138029954256, 0.99044018082979657,
+    0.9901856840492963, 0.9899167587529355, 0.98963214170001168,
+    0.98933041778051301, 0.98900999649752486, 0.98866908394244624,
+    0.98830564922259712, 0.98791738401712093, 0.98750165356338815,
+    0.98705543687947483, 0.98657525336211771, 0.98605707199708514,
+    0.98549619818312217, 0.98488713145918694, 0.98422338502500317,
+    0.98349725453546877, 0.98269951873519645, 0.98181904730500646,
+    0.98084228057918443, 0.9797525295405265, 0.9785290193370112,
+    0.9771455597134634, 0.97556866103830675, 0.9737548065309739,
+    0.97164640502160071, 0.96916561582307148, 0.96620461802642488,
+    0.96260968808093417, 0.9581539565708268, 0.95248822053365945,
+    0.94504606470174779, 0.93484490883825566, 0.92002063809432388,
+    0.89656229712375124, 0.85400662445287367, 0.75380413886328379, 0
+};
+
+CONSTANT
+float x_1024_f[1025] = {
+    4.2734453f, 4.03884985f, 3.85600265f, 3.74261322f, 3.65940956f,
+    3.59326702f, 3.53814759f, 3.49076036f, 3.44910891f, 3.41188859f,
+    3.37819874f, 3.3473908f, 3.31898184f, 3.29260232f, 3.26796297f,
+    3.24483304f, 3.22302538f, 3.20238609f, 3.18278699f, 3.16412022f,
+    3.14629407f, 3.12922994f, 3.11285991f, 3.09712489f, 3.08197314f,
+    3.06735908f, 3.05324238f, 3.03958712f, 3.02636122f, 3.01353587f,
+    3.00108512f, 2.98898551f, 2.97721573f, 2.96575641f, 2.95458984f,
+    2.94369983f, 2.9330715f, 2.92269118f, 2.91254624f, 2.90262503f,
+    2.89291673f, 2.88341132f, 2.87409948f, 2.86497252f, 2.85602235f,
+    2.84724139f, 2.83862255f, 2.83015919f, 2.82184507f, 2.81367433f,
+    2.80564145f, 2.79774123f, 2.78996876f, 2.78231941f, 2.7747888f,
+    2.76737277f, 2.7600674f, 2.75286896f, 2.7457739f, 2.73877887f,
+    2.73188065f, 2.72507621f, 2.71836263f, 2.71173716f, 2.70519715f,
+    2.69874008f, 2.69236353f, 2.68606521f, 2.67984291f, 2.67369451f,
+    2.66761799f, 2.66161141f, 2.6556729f, 2.64980069f, 2.64399304f,
+    2.63824832f, 2.63256493f, 2.62694135f, 2.62137611f, 2.61586779f,
+    2.61041503f, 2.60501651f, 2.59967098f, 2.59437719f, 2.58913398f,
+    2.58394021f, 2.57879476f, 2.57369658f, 2.56864464f, 2.56363794f,
+    2.55867552f, 2.55375645f, 2.54887982f, 2.54404475f, 2.53925041f,
+    2.53449597f, 2.52978062f, 2.52510361f, 2.52046417f, 2.51586159f,
+    2.51129515f, 2.50676416f, 2.50226797f, 2.49780592f, 2.49337738f,
+    2.48898175f, 2.48461842f, 2.48028681f, 2.47598636f, 2.47171653f,
+    2.46747678f, 2.46326658f, 2.45908543f, 2.45493284f, 2.45080833f,
+    2.44671142f, 2.44264167f, 2.43859861f, 2.43458182f, 2.43059088f,
+    2.42662536f, 2.42268487f, 2.41876901f, 2.4148774f, 2.41100965f,
+    2.4071654f, 2.4033443f, 2.39954599f, 2.39577012f, 2.39201636f,
+    2.38828439f, 2.38457388f, 2.38088453f, 2.37721601f, 2.37356804f,
+    2.36994032f, 2.36633256f, 2.36274448f, 2.3591758f, 2.35562626f,
+    2.3520956f, 2.34858354f, 2.34508984f, 2.34161425f, 2.33815653f,
+    2.33471644f, 2.33129374f, 2.32788821f, 2.32449962f, 2.32112774f,
+    2.31777238f, 2.3144333f, 2.31111031f, 2.30780319f, 2.30451176f,
+    2.30123581f, 2.29797515f, 2.29472959f, 2.29149895f, 2.28828304f,
+    2.28508168f, 2.2818947f, 2.27872193f, 2.27556318f, 2.27241831f,
+    2.26928714f, 2.26616951f, 2.26306527f, 2.25997426f, 2.25689632f,
+    2.2538313f, 2.25077907f, 2.24773946f, 2.24471235f, 2.24169758f,
+    2.23869503f, 2.23570455f, 2.23272601f, 2.22975928f, 2.22680423f,
+    2.22386072f, 2.22092865f, 2.21800788f, 2.21509829f, 2.21219976f,
+    2.20931218f, 2.20643542f, 2.20356938f, 2.20071394f, 2.19786899f,
+    2.19503442f, 2.19221013f, 2.189396f, 2.18659194f, 2.18379784f,
+    2.1810136f, 2.17823912f, 2.1754743f, 2.17271905f, 2.16997327f,
+    2.16723686f, 2.16450973f, 2.1617918f, 2.15908297f, 2.15638315f,
+    2.15369225f, 2.15101019f, 2.14833689f, 2.14567225f, 2.1430162f,
+    2.14036865f, 2.13772953f, 2.13509875f, 2.13247623f, 2.1298619f,
+    2.12725568f, 2.1246575f, 2.12206728f, 2.11948494f, 2.11691042f,
+    2.11434365f, 2.11178454f, 2.10923304f, 2.10668907f, 2.10415257f,
+    2.10162346f, 2.09910169f, 2.09658718f, 2.09407987f, 2.0915797f,
+    2.08908661f, 2.08660053f, 2.0841214f, 2.08164915f, 2.07918374f,
+    2.0767251f, 2.07427317f, 2.07182789f, 2.06938921f, 2.06695707f,
+    2.06453141f, 2.06211218f, 2.05969932f, 2.05729279f, 2.05489252f,
+    2.05249846f, 2.05011056f, 2.04772878f, 2.04535305f, 2.04298333f,
+    2.04061957f, 2.03826172f, 2.03590972f, 2.03356354f, 2.03122313f,
+    2.02888843f, 2.0265594f, 2.02423599f, 2.02191817f, 2.01960587f,
+    2.01729907f, 2.01499771f, 2.01270175f, 2.01041115f, 2.00812586f,
+    2.00584585f, 2.00357107f, 2.00130147f, 1.99903702f, 1.99677769f,
+    1.99452341f, 1.99227417f, 1.99002991f, 1.9877906f, 1.98555621f,
+    1.98332668f, 1.98110199f, 1.9788821f, 1.97666696f, 1.97445655f,
+    1.97225082f, 1.97004975f, 1.96785329f, 1.96566141f, 1.96347408f,
+    1.96129125f, 1.95911291f, 1.956939f, 1.9547695f, 1.95260438f,
+    1.9504436f, 1.94828713f, 1.94613493f, 1.94398698f, 1.94184324f,
+    1.93970369f, 1.93756828f, 1.935437f, 1.9333098f, 1.93118666f,
+    1.92906755f, 1.92695244f, 1.9248413f, 1.92273409f, 1.9206308f,
+    1.91853139f, 1.91643583f, 1.9143441f, 1.91225617f, 1.910172f,
+    1.90809158f, 1.90601487f, 1.90394185f, 1.90187248f, 1.89980676f,
+    1.89774464f, 1.8956861f, 1.89363112f, 1.89157966f, 1.88953171f,
+    1.88748724f, 1.88544623f, 1.88340864f, 1.88137446f, 1.87934365f,
+    1.87731621f, 1.87529209f, 1.87327128f, 1.87125376f, 1.86923949f,
+    1.86722847f, 1.86522065f, 1.86321603f, 1.86121458f, 1.85921627f,
+    1.85722109f, 1.855229f, 1.85324f, 1.85125405f, 1.84927114f,
+    1.84729124f, 1.84531434f, 1.8433404f, 1.84136942f, 1.83940136f,
+    1.83743621f, 1.83547395f, 1.83351456f, 1.83155801f, 1.8296043f,
+    1.82765338f, 1.82570526f, 1.8237599f, 1.82181729f, 1.81987741f,
+    1.81794023f, 1.81600575f, 1.81407393f, 1.81214477f, 1.81021824f,
+    1.80829432f, 1.806373f, 1.80445426f, 1.80253808f, 1.80062444f,
+    1.79871332f, 1.7968047f, 1.79489857f, 1.79299492f, 1.79109371f,
+    1.78919494f, 1.78729858f, 1.78540463f, 1.78351306f, 1.78162385f,
+    1.77973699f, 1.77785247f, 1.77597026f, 1.77409035f, 1.77221273f,
+    1.77033737f, 1.76846426f, 1.76659338f, 1.76472472f, 1.76285827f,
+    1.760994f, 1.7591319f, 1.75727195f, 1.75541415f, 1.75355847f,
+    1.7517049f, 1.74985342f, 1.74800401f, 1.74615668f, 1.74431139f,
+    1.74246813f, 1.74062689f, 1.73878765f, 1.73695041f, 1.73511513f,
+    1.73328182f, 1.73145045f, 1.72962102f, 1.7277935f, 1.72596788f,
+    1.72414415f, 1.7223223f, 1.7205023f, 1.71868416f, 1.71686784f,
+    1.71505335f, 1.71324066f, 1.71142976f, 1.70962064f, 1.70781328f,
+    1.70600768f, 1.70420382f, 1.70240168f, 1.70060125f, 1.69880252f,
+    1.69700548f, 1.69521011f, 1.6934164f, 1.69162434f, 1.68983391f,
+    1.6880451f, 1.6862579f, 1.6844723f, 1.68268828f, 1.68090584f,
+    1.67912495f, 1.67734561f, 1.6755678f, 1.67379152f, 1.67201674f,
+    1.67024347f, 1.66847168f, 1.66670136f, 1.6649325f, 1.6631651f,
+    1.66139913f, 1.65963459f, 1.65787146f, 1.65610974f, 1.65434941f,
+    1.65259045f, 1.65083287f, 1.64907664f, 1.64732175f, 1.6455682f,
+    1.64381597f, 1.64206505f, 1.64031544f, 1.6385671f, 1.63682005f,
+    1.63507426f, 1.63332973f, 1.63158644f, 1.62984438f, 1.62810355f,
+    1.62636393f, 1.6246255f, 1.62288827f, 1.62115221f, 1.61941732f,
+    1.61768358f, 1.615951f, 1.61421955f, 1.61248922f, 1.61076f,
+    1.60903189f, 1.60730488f, 1.60557894f, 1.60385408f, 1.60213028f,
+    1.60040753f, 1.59868582f, 1.59696514f, 1.59524548f, 1.59352683f,
+    1.59180918f, 1.59009252f, 1.58837684f, 1.58666212f, 1.58494837f,
+    1.58323557f, 1.5815237f, 1.57981276f, 1.57810274f, 1.57639363f,
+    1.57468542f, 1.5729781f, 1.57127166f, 1.56956608f, 1.56786137f,
+    1.5661575f, 1.56445448f, 1.56275228f, 1.56105091f, 1.55935034f,
+    1.55765057f, 1.5559516f, 1.55425341f, 1.55255599f, 1.55085933f,
+    1.54916342f, 1.54746825f, 1.54577382f, 1.54408012f, 1.54238712f,
+    1.54069483f, 1.53900324f, 1.53731233f, 1.5356221f, 1.53393253f,
+    1.53224362f, 1.53055536f, 1.52886774f, 1.52718075f, 1.52549437f,
+    1.52380861f, 1.52212345f, 1.52043888f, 1.51875489f, 1.51707148f,
+    1.51538862f, 1.51370633f, 1.51202457f, 1.51034336f, 1.50866267f,
+    1.5069825f, 1.50530284f, 1.50362367f, 1.501945f, 1.5002668f,
+    1.49858908f, 1.49691182f, 1.49523501f, 1.49355865f, 1.49188272f,
+    1.49020722f, 1.48853213f, 1.48685745f, 1.48518317f, 1.48350928f,
+    1.48183577f, 1.48016263f, 1.47848985f, 1.47681743f, 1.47514534f,
+    1.4734736f, 1.47180217f, 1.47013107f, 1.46846027f, 1.46678977f,
+    1.46511956f, 1.46344963f, 1.46177996f, 1.46011057f, 1.45844142f,
+    1.45677252f, 1.45510385f, 1.45343541f, 1.45176718f, 1.45009916f,
+    1.44843134f, 1.44676371f, 1.44509626f, 1.44342897f, 1.44176185f,
+    1.44009489f, 1.43842807f, 1.43676138f, 1.43509481f, 1.43342837f,
+    1.43176203f, 1.43009578f, 1.42842963f, 1.42676356f, 1.42509755f,
+    1.42343161f, 1.42176572f, 1.42009988f, 1.41843406f, 1.41676827f,
+    1.4151025f, 1.41343673f, 1.41177096f, 1.41010518f, 1.40843938f,
+    1.40677354f, 1.40510767f, 1.40344174f, 1.40177576f, 1.4001097f,
+    1.39844358f, 1.39677736f, 1.39511105f, 1.39344463f, 1.3917781f,
+    1.39011144f, 1.38844465f, 1.38677771f, 1.38511063f, 1.38344338f,
+    1.38177595f, 1.38010835f, 1.37844056f, 1.37677257f, 1.37510436f,
+    1.37343594f, 1.37176729f, 1.3700984f, 1.36842926f, 1.36675986f,
+    1.3650902f, 1.36342026f, 1.36175003f, 1.3600795f, 1.35840867f,
+    1.35673752f, 1.35506605f, 1.35339423f, 1.35172208f, 1.35004956f,
+    1.34837668f, 1.34670342f, 1.34502978f, 1.34335574f, 1.3416813f,
+    1.34000644f, 1.33833115f, 1.33665543f, 1.33497926f, 1.33330263f,
+    1.33162553f, 1.32994796f, 1.3282699f, 1.32659134f, 1.32491228f,
+    1.32323269f, 1.32155257f, 1.31987192f, 1.31819071f, 1.31650895f,
+    1.31482661f, 1.31314369f, 1.31146017f, 1.30977606f, 1.30809132f,
+    1.30640597f, 1.30471997f, 1.30303333f, 1.30134604f, 1.29965807f,
+    1.29796942f, 1.29628008f, 1.29459004f, 1.29289929f, 1.29120781f,
+    1.2895156f, 1.28782263f, 1.28612891f, 1.28443443f, 1.28273915f,
+    1.28104309f, 1.27934622f, 1.27764854f, 1.27595003f, 1.27425068f,
+    1.27255047f, 1.27084941f, 1.26914747f, 1.26744464f, 1.26574092f,
+    1.26403628f, 1.26233072f, 1.26062423f, 1.25891679f, 1.25720839f,
+    1.25549901f, 1.25378866f, 1.2520773f, 1.25036494f, 1.24865155f,
+    1.24693713f, 1.24522166f, 1.24350513f, 1.24178753f, 1.24006884f,
+    1.23834905f, 1.23662815f, 1.23490613f, 1.23318296f, 1.23145864f,
+    1.22973316f, 1.2280065f, 1.22627864f, 1.22454958f, 1.2228193f,
+    1.22108778f, 1.21935502f, 1.217621f, 1.21588569f, 1.2141491f,
+    1.21241121f, 1.21067199f, 1.20893144f, 1.20718955f, 1.20544629f,
+    1.20370166f, 1.20195563f, 1.2002082f, 1.19845934f, 1.19670905f,
+    1.19495731f, 1.19320409f, 1.1914494f, 1.18969321f, 1.1879355f,
+    1.18617627f, 1.18441549f, 1.18265314f, 1.18088922f, 1.17912371f,
+    1.17735658f, 1.17558783f, 1.17381744f, 1.17204539f, 1.17027166f,
+    1.16849624f, 1.16671911f, 1.16494025f, 1.16315964f, 1.16137727f,
+    1.15959313f, 1.15780718f, 1.15601943f, 1.15422983f, 1.15243839f,
+    1.15064508f, 1.14884988f, 1.14705277f, 1.14525374f, 1.14345277f,
+    1.14164983f, 1.13984491f, 1.13803799f, 1.13622905f, 1.13441807f,
+    1.13260502f, 1.1307899f, 1.12897268f, 1.12715334f, 1.12533186f,
+    1.12350821f, 1.12168239f, 1.11985436f, 1.1180241f, 1.1161916f,
+    1.11435684f, 1.11251978f, 1.11068042f, 1.10883872f, 1.10699466f,
+    1.10514823f, 1.1032994f, 1.10144814f, 1.09959443f, 1.09773826f,
+    1.09587959f, 1.09401841f, 1.09215468f, 1.09028839f, 1.08841951f,
+    1.08654801f, 1.08467387f, 1.08279707f, 1.08091757f, 1.07903536f,
+    1.07715041f, 1.07526269f, 1.07337217f, 1.07147883f, 1.06958264f,
+    1.06768358f, 1.06578161f, 1.06387671f, 1.06196885f, 1.060058f,
+    1.05814414f, 1.05622722f, 1.05430723f, 1.05238414f, 1.05045791f,
+    1.04852852f, 1.04659593f, 1.04466011f, 1.04272103f, 1.04077866f,
+    1.03883297f, 1.03688393f, 1.03493149f, 1.03297564f, 1.03101633f,
+    1.02905354f, 1.02708722f, 1.02511734f, 1.02314387f, 1.02116678f,
+    1.01918602f, 1.01720156f, 1.01521336f, 1.01322139f, 1.01122561f,
+    1.00922598f, 1.00722246f, 1.00521501f, 1.00320359f, 1.00118817f,
+    0.999168704f, 0.997145147f, 0.99511746f, 0.993085601f,
+    0.991049527f, 0.989009195f, 0.986964561f, 0.984915582f,
+    0.982862212f, 0.980804406f, 0.978742118f, 0.976675301f,
+    0.974603908f, 0.972527891f, 0.970447202f, 0.96836179f,
+    0.966271607f, 0.964176602f, 0.962076723f, 0.959971919f,
+    0.957862136f, 0.955747322f, 0.953627422f, 0.951502381f,
+    0.949372143f, 0.947236651f, 0.945095849f, 0.942949678f,
+    0.940798078f, 0.938640991f, 0.936478354f, 0.934310107f,
+    0.932136185f, 0.929956527f, 0.927771066f, 0.925579738f,
+    0.923382475f, 0.92117921f, 0.918969875f, 0.916754398f,
+    0.91453271f, 0.912304738f, 0.910070408f, 0.907829647f,
+    0.905582378f, 0.903328526f, 0.90106801f, 0.898800753f,
+    0.896526672f, 0.894245686f, 0.891957712f, 0.889662663f,
+    0.887360454f, 0.885050997f, 0.882734202f, 0.880409977f,
+    0.878078231f, 0.875738868f, 0.873391793f, 0.871036907f,
+    0.868674112f, 0.866303304f, 0.863924382f, 0.86153724f,
+    0.85914177f, 0.856737864f, 0.854325409f, 0.851904292f,
+    0.849474398f, 0.847035608f, 0.844587803f, 0.842130858f,
+    0.83966465f, 0.837189051f, 0.834703929f, 0.832209153f,
+    0.829704587f, 0.827190091f, 0.824665525f, 0.822130744f,
+    0.8195856f, 0.817029943f, 0.814463619f, 0.811886471f,
+    0.809298337f, 0.806699054f, 0.804088453f, 0.801466363f,
+    0.798832607f, 0.796187006f, 0.793529376f, 0.790859528f,
+    0.78817727f, 0.785482404f, 0.782774728f, 0.780054036f,
+    0.777320114f, 0.774572745f, 0.771811707f, 0.769036771f,
+    0.766247702f, 0.763444261f, 0.7606262f, 0.757793267f,
+    0.754945202f, 0.752081738f, 0.7492026f, 0.746307508f,
+    0.743396172f, 0.740468295f, 0.73752357f, 0.734561684f,
+    0.731582312f, 0.728585122f, 0.72556977f, 0.722535904f,
+    0.719483159f, 0.716411161f, 0.713319524f, 0.710207848f,
+    0.707075722f, 0.703922722f, 0.70074841f, 0.697552333f,
+    0.694334024f, 0.691092999f, 0.687828758f, 0.684540786f,
+    0.681228545f, 0.677891483f, 0.674529025f, 0.671140576f,
+    0.66772552f, 0.664283217f, 0.660813001f, 0.657314184f,
+    0.653786048f, 0.650227849f, 0.64663881f, 0.643018125f,
+    0.639364953f, 0.635678419f, 0.631957608f, 0.628201567f,
+    0.624409301f, 0.620579769f, 0.616711884f, 0.612804505f,
+    0.608856441f, 0.604866441f, 0.600833192f, 0.596755318f,
+    0.592631369f, 0.588459823f, 0.584239075f, 0.579967434f,
+    0.575643114f, 0.571264231f, 0.566828788f, 0.562334676f,
+    0.557779653f, 0.553161344f, 0.548477219f, 0.543724588f,
+    0.538900582f, 0.534002137f, 0.529025974f, 0.523968581f,
+    0.518826188f, 0.513594738f, 0.508269861f, 0.502846834f,
+    0.497320545f, 0.491685448f, 0.485935506f, 0.480064134f,
+    0.474064126f, 0.467927573f, 0.461645764f, 0.45520907f,
+    0.448606808f, 0.441827072f, 0.434856537f, 0.42768021f,
+    0.420281137f, 0.412640025f, 0.404734783f, 0.396539928f,
+    0.388025827f, 0.379157714f, 0.369894383f, 0.360186433f,
+    0.349973853f, 0.339182625f, 0.327719818f, 0.315466272f,
+    0.302265257f, 0.287904097f, 0.272082634f, 0.254355065f,
+    0.234011909f, 0.209806255f, 0.179175931f, 0.135063559f, 0.0f
+};
+
+CONSTANT
+float y_1024_f[1024] = {
+    0.945103906f, 0.954727906f, 0.970594048f, 0.977768563f,
+    0.981925354f, 0.984660356f, 0.986606768f, 0.988068088f,
+    0.989208714f, 0.990125748f, 0.990880366f, 0.991513104f,
+    0.992051922f, 0.992516756f, 0.992922217f, 0.993279267f,
+    0.993596298f, 0.993879847f, 0.994135085f, 0.99436616f,
+    0.994576435f, 0.994768671f, 0.994945156f, 0.995107801f,
+    0.995258215f, 0.995397766f, 0.99552762f, 0.995648783f,
+    0.995762123f, 0.995868393f, 0.995968254f, 0.996062284f,
+    0.996150993f, 0.996234833f, 0.996314205f, 0.996389467f,
+    0.996460938f, 0.996528905f, 0.996593628f, 0.996655338f,
+    0.996714247f, 0.996770547f, 0.996824412f, 0.996876001f,
+    0.996925457f, 0.996972916f, 0.997018497f, 0.997062314f,
+    0.997104469f, 0.997145057f, 0.997184166f, 0.997221878f,
+    0.997258267f, 0.997293405f, 0.997327355f, 0.997360179f,
+    0.997391932f, 0.997422668f, 0.997452435f, 0.99748128f,
+    0.997509245f, 0.997536372f, 0.997562698f, 0.997588258f,
+    0.997613086f, 0.997637215f, 0.997660672f, 0.997683487f,
+    0.997705686f, 0.997727295f, 0.997748335f, 0.997768831f,
+    0.997788803f, 0.997808271f, 0.997827255f, 0.997845772f,
+    0.99786384f, 0.997881474f, 0.997898692f, 0.997915506f,
+    0.997931932f, 0.997947983f, 0.997963672f, 0.99797901f,
+    0.99799401f, 0.998008683f, 0.998023038f, 0.998037088f,
+    0.99805084f, 0.998064305f, 0.998077492f, 0.998090409f,
+    0.998103063f, 0.998115464f, 0.998127619f, 0.998139534f,
+    0.998151217f, 0.998162675f, 0.998173914f, 0.99818494f,
+    0.998195758f, 0.998206376f, 0.998216798f, 0.998227029f,
+    0.998237075f, 0.998246941f, 0.998256631f, 0.99826615f,
+    0.998275502f, 0.998284692f, 0.998293724f, 0.998302601f,
+    0.998311328f, 0.998319908f, 0.998328345f, 0.998336642f,
+    0.998344802f, 0.99835283f, 0.998360727f, 0.998368498f,
+    0.998376144f, 0.998383669f, 0.998391076f, 0.998398367f,
+    0.998405545f, 0.998412612f, 0.998419571f, 0.998426424f,
+    0.998433174f, 0.998439822f, 0.998446371f, 0.998452823f,
+    0.99845918f, 0.998465444f, 0.998471617f, 0.9984777f,
+    0.998483696f, 0.998489606f, 0.998495432f, 0.998501176f,
+    0.998506839f, 0.998512423f, 0.99851793f, 0.99852336f,
+    0.998528716f, 0.998533998f, 0.998539209f, 0.998544349f,
+    0.99854942f, 0.998554423f, 0.99855936f, 0.998564231f,
+    0.998569037f, 0.998573781f, 0.998578463f, 0.998583083f,
+    0.998587644f, 0.998592146f, 0.998596591f, 0.998600978f,
+    0.99860531f, 0.998609587f, 0.99861381f, 0.99861798f,
+    0.998622098f, 0.998626164f, 0.998630181f, 0.998634147f,
+    0.998638065f, 0.998641934f, 0.998645757f, 0.998649533f,
+    0.998653263f, 0.998656948f, 0.998660589f, 0.998664186f,
+    0.99866774f, 0.998671251f, 0.998674721f, 0.99867815f,
+    0.998681539f, 0.998684888f, 0.998688197f, 0.998691468f,
+    0.9986947f, 0.998697895f, 0.998701053f, 0.998704175f,
+    0.998707261f, 0.998710311f, 0.998713326f, 0.998716307f,
+    0.998719253f, 0.998722166f, 0.998725047f, 0.998727894f,
+    0.99873071f, 0.998733493f, 0.998736246f, 0.998738967f,
+    0.998741658f, 0.998744319f, 0.99874695f, 0.998749552f,
+    0.998752125f, 0.99875467f, 0.998757186f, 0.998759675f,
+    0.998762136f, 0.99876457f, 0.998766977f, 0.998769357f,
+    0.998771712f, 0.998774041f, 0.998776344f, 0.998778622f,
+    0.998780875f, 0.998783104f, 0.998785309f, 0.998787489f,
+    0.998789646f, 0.998791779f, 0.998793889f, 0.998795976f,
+    0.998798041f, 0.998800083f, 0.998802103f, 0.998804101f,
+    0.998806078f, 0.998808033f, 0.998809967f, 0.99881188f,
+    0.998813773f, 0.998815645f, 0.998817496f, 0.998819328f,
+    0.99882114f, 0.998822933f, 0.998824706f, 0.998826459f,
+    0.998828194f, 0.99882991f, 0.998831608f, 0.998833287f,
+    0.998834948f, 0.998836591f, 0.998838216f, 0.998839823f,
+    0.998841413f, 0.998842985f, 0.998844541f, 0.998846079f,
+    0.998847601f, 0.998849106f, 0.998850594f, 0.998852066f,
+    0.998853522f, 0.998854962f, 0.998856387f, 0.998857795f,
+    0.998859188f, 0.998860565f, 0.998861927f, 0.998863274f,
+    0.998864606f, 0.998865923f, 0.998867225f, 0.998868513f,
+    0.998869786f, 0.998871045f, 0.99887229f, 0.99887352f,
+    0.998874737f, 0.998875939f, 0.998877128f, 0.998878303f,
+    0.998879465f, 0.998880613f, 0.998881748f, 0.99888287f,
+    0.998883979f, 0.998885074f, 0.998886157f, 0.998887227f,
+    0.998888285f, 0.99888933f, 0.998890362f, 0.998891382f,
+    0.99889239f, 0.998893385f, 0.998894369f, 0.99889534f, 0.9988963f,
+    0.998897247f, 0.998898183f, 0.998899108f, 0.99890002f,
+    0.998900922f, 0.998901812f, 0.99890269f, 0.998903557f,
+    0.998904414f, 0.998905259f, 0.998906093f, 0.998906916f,
+    0.998907728f, 0.99890853f, 0.998909321f, 0.998910101f,
+    0.998910871f, 0.99891163f, 0.998912379f, 0.998913117f,
+    0.998913845f, 0.998914563f, 0.998915271f, 0.998915969f,
+    0.998916656f, 0.998917334f, 0.998918002f, 0.99891866f,
+    0.998919308f, 0.998919946f, 0.998920575f, 0.998921194f,
+    0.998921803f, 0.998922404f, 0.998922994f, 0.998923575f,
+    0.998924147f, 0.99892471f, 0.998925263f, 0.998925807f,
+    0.998926342f, 0.998926868f, 0.998927385f, 0.998927893f,
+    0.998928392f, 0.998928882f, 0.998929363f, 0.998929835f,
+    0.998930299f, 0.998930754f, 0.9989312f, 0.998931637f,
+    0.998932066f, 0.998932487f, 0.998932899f, 0.998933302f,
+    0.998933697f, 0.998934084f, 0.998934462f, 0.998934832f,
+    0.998935194f, 0.998935547f, 0.998935892f, 0.998936229f,
+    0.998936558f, 0.998936879f, 0.998937191f, 0.998937496f,
+    0.998937793f, 0.998938081f, 0.998938362f, 0.998938635f,
+    0.9989389f, 0.998939157f, 0.998939406f, 0.998939648f,
+    0.998939881f, 0.998940107f, 0.998940326f, 0.998940536f,
+    0.998940739f, 0.998940934f, 0.998941122f, 0.998941302f,
+    0.998941475f, 0.99894164f, 0.998941797f, 0.998941947f,
+    0.99894209f, 0.998942225f, 0.998942353f, 0.998942473f,
+    0.998942586f, 0.998942692f, 0.99894279f, 0.998942881f,
+    0.998942965f, 0.998943042f, 0.998943111f, 0.998943173f,
+    0.998943227f, 0.998943275f, 0.998943315f, 0.998943349f,
+    0.998943375f, 0.998943394f, 0.998943406f, 0.99894341f,
+    0.998943408f, 0.998943399f, 0.998943382f, 0.998943359f,
+    0.998943328f, 0.998943291f, 0.998943246f, 0.998943195f,
+    0.998943136f, 0.998943071f, 0.998942999f, 0.998942919f,
+    0.998942833f, 0.99894274f, 0.99894264f, 0.998942533f,
+    0.998942419f, 0.998942298f, 0.998942171f, 0.998942036f,
+    0.998941895f, 0.998941747f, 0.998941592f, 0.99894143f,
+    0.998941262f, 0.998941086f, 0.998940904f, 0.998940715f,
+    0.998940519f, 0.998940317f, 0.998940107f, 0.998939891f,
+    0.998939668f, 0.998939439f, 0.998939202f, 0.998938959f,
+    0.998938709f, 0.998938452f, 0.998938189f, 0.998937919f,
+    0.998937642f, 0.998937358f, 0.998937067f, 0.99893677f,
+    0.998936466f, 0.998936155f, 0.998935838f, 0.998935514f,
+    0.998935183f, 0.998934845f, 0.998934501f, 0.99893415f,
+    0.998933792f, 0.998933427f, 0.998933056f, 0.998932678f,
+    0.998932293f, 0.998931901f, 0.998931503f, 0.998931098f,
+    0.998930686f, 0.998930267f, 0.998929841f, 0.998929409f,
+    0.99892897f, 0.998928524f, 0.998928072f, 0.998927612f,
+    0.998927146f, 0.998926673f, 0.998926193f, 0.998925706f,
+    0.998925213f, 0.998924713f, 0.998924205f, 0.998923691f,
+    0.99892317f, 0.998922643f, 0.998922108f, 0.998921566f,
+    0.998921018f, 0.998920462f, 0.9989199f, 0.998919331f,
+    0.998918755f, 0.998918172f, 0.998917582f, 0.998916985f,
+    0.99891638f, 0.998915769f, 0.998915151f, 0.998914526f,
+    0.998913894f, 0.998913255f, 0.998912609f, 0.998911956f,
+    0.998911295f, 0.998910628f, 0.998909953f, 0.998909271f,
+    0.998908582f, 0.998907886f, 0.998907183f, 0.998906473f,
+    0.998905755f, 0.99890503f, 0.998904298f, 0.998903558f,
+    0.998902812f, 0.998902058f, 0.998901296f, 0.998900528f,
+    0.998899752f, 0.998898968f, 0.998898177f, 0.998897379f,
+    0.998896574f, 0.99889576f, 0.99889494f, 0.998894112f,
+    0.998893276f, 0.998892433f, 0.998891582f, 0.998890724f,
+    0.998889858f, 0.998888984f, 0.998888103f, 0.998887214f,
+    0.998886317f, 0.998885413f, 0.998884501f, 0.998883581f,
+    0.998882653f, 0.998881717f, 0.998880774f, 0.998879822f,
+    0.998878863f, 0.998877896f, 0.998876921f, 0.998875938f,
+    0.998874946f, 0.998873947f, 0.99887294f, 0.998871924f,
+    0.9988709f, 0.998869868f, 0.998868828f, 0.99886778f,
+    0.998866723f, 0.998865658f, 0.998864585f, 0.998863503f,
+    0.998862413f, 0.998861315f, 0.998860208f, 0.998859092f,
+    0.998857968f, 0.998856836f, 0.998855694f, 0.998854544f,
+    0.998853386f, 0.998852218f, 0.998851042f, 0.998849857f,
+    0.998848664f, 0.998847461f, 0.998846249f, 0.998845029f,
+    0.998843799f, 0.99884256f, 0.998841313f, 0.998840056f,
+    0.99883879f, 0.998837514f, 0.99883623f, 0.998834936f,
+    0.998833633f, 0.99883232f, 0.998830998f, 0.998829666f,
+    0.998828325f, 0.998826975f, 0.998825614f, 0.998824244f,
+    0.998822865f, 0.998821475f, 0.998820076f, 0.998818667f,
+    0.998817247f, 0.998815818f, 0.998814379f, 0.99881293f,
+    0.99881147f, 0.998810001f, 0.998808521f, 0.998807031f,
+    0.99880553f, 0.998804019f, 0.998802498f, 0.998800966f,
+    0.998799423f, 0.99879787f, 0.998796306f, 0.998794731f,
+    0.998793146f, 0.998791549f, 0.998789942f, 0.998788323f,
+    0.998786694f, 0.998785053f, 0.998783401f, 0.998781738f,
+    0.998780064f, 0.998778378f, 0.99877668f, 0.998774971f,
+    0.998773251f, 0.998771518f, 0.998769774f, 0.998768018f,
+    0.998766251f, 0.998764471f, 0.998762679f, 0.998760875f,
+    0.998759059f, 0.99875723f, 0.998755389f, 0.998753536f,
+    0.99875167f, 0.998749792f, 0.9987479f, 0.998745996f, 0.99874408f,
+    0.99874215f, 0.998740207f, 0.998738251f, 0.998736282f,
+    0.9987343f, 0.998732304f, 0.998730295f, 0.998728272f,
+    0.998726236f, 0.998724186f, 0.998722122f, 0.998720044f,
+    0.998717952f, 0.998715846f, 0.998713725f, 0.998711591f,
+    0.998709441f, 0.998707278f, 0.9987051f, 0.998702907f,
+    0.998700699f, 0.998698476f, 0.998696238f, 0.998693985f,
+    0.998691717f, 0.998689433f, 0.998687134f, 0.998684819f,
+    0.998682489f, 0.998680142f, 0.99867778f, 0.998675401f,
+    0.998673007f, 0.998670596f, 0.998668168f, 0.998665724f,
+    0.998663263f, 0.998660786f, 0.998658291f, 0.998655779f,
+    0.99865325f, 0.998650704f, 0.99864814f, 0.998645559f,
+    0.998642959f, 0.998640342f, 0.998637707f, 0.998635053f,
+    0.998632381f, 0.998629691f, 0.998626982f, 0.998624254f,
+    0.998621507f, 0.998618741f, 0.998615956f, 0.998613151f,
+    0.998610327f, 0.998607483f, 0.998604619f, 0.998601734f,
+    0.99859883f, 0.998595905f, 0.998592959f, 0.998589993f,
+    0.998587006f, 0.998583997f, 0.998580967f, 0.998577916f,
+    0.998574843f, 0.998571748f, 0.998568631f, 0.998565491f,
+    0.998562329f, 0.998559145f, 0.998555937f, 0.998552706f,
+    0.998549452f, 0.998546175f, 0.998542874f, 0.998539548f,
+    0.998536199f, 0.998532825f, 0.998529427f, 0.998526003f,
+    0.998522555f, 0.998519081f, 0.998515582f, 0.998512057f,
+    0.998508506f, 0.998504928f, 0.998501324f, 0.998497694f,
+    0.998494036f, 0.998490351f, 0.998486638f, 0.998482897f,
+    0.998479129f, 0.998475332f, 0.998471506f, 0.998467651f,
+    0.998463767f, 0.998459853f, 0.99845591f, 0.998451936f,
+    0.998447932f, 0.998443898f, 0.998439832f, 0.998435735f,
+    0.998431606f, 0.998427445f, 0.998423251f, 0.998419025f,
+    0.998414766f, 0.998410474f, 0.998406147f, 0.998401787f,
+    0.998397392f, 0.998392963f, 0.998388498f, 0.998383997f,
+    0.998379461f, 0.998374888f, 0.998370279f, 0.998365632f,
+    0.998360948f, 0.998356226f, 0.998351466f, 0.998346666f,
+    0.998341828f, 0.998336949f, 0.998332031f, 0.998327072f,
+    0.998322072f, 0.99831703f, 0.998311947f, 0.998306821f,
+    0.998301652f, 0.998296439f, 0.998291183f, 0.998285882f,
+    0.998280536f, 0.998275145f, 0.998269707f, 0.998264223f,
+    0.998258692f, 0.998253113f, 0.998247485f, 0.998241809f,
+    0.998236083f, 0.998230307f, 0.998224481f, 0.998218603f,
+    0.998212673f, 0.99820669f, 0.998200655f, 0.998194565f,
+    0.99818842f, 0.998182221f, 0.998175965f, 0.998169652f,
+    0.998163282f, 0.998156854f, 0.998150367f, 0.99814382f,
+    0.998137212f, 0.998130544f, 0.998123813f, 0.998117019f,
+    0.998110161f, 0.998103239f, 0.998096251f, 0.998089197f,
+    0.998082075f, 0.998074886f, 0.998067627f, 0.998060298f,
+    0.998052897f, 0.998045425f, 0.99803788f, 0.998030261f,
+    0.998022566f, 0.998014795f, 0.998006947f, 0.997999021f,
+    0.997991015f, 0.997982928f, 0.997974759f, 0.997966507f,
+    0.997958171f, 0.99794975f, 0.997941241f, 0.997932645f,
+    0.997923959f, 0.997915182f, 0.997906313f, 0.99789735f,
+    0.997888293f, 0.997879139f, 0.997869886f, 0.997860535f,
+    0.997851082f, 0.997841527f, 0.997831867f, 0.997822101f,
+    0.997812228f, 0.997802246f, 0.997792152f, 0.997781945f,
+    0.997771623f, 0.997761185f, 0.997750628f, 0.99773995f,
+    0.99772915f, 0.997718225f, 0.997707173f, 0.997695992f,
+    0.997684679f, 0.997673234f, 0.997661652f, 0.997649933f,
+    0.997638072f, 0.997626069f, 0.99761392f, 0.997601622f,
+    0.997589174f, 0.997576572f, 0.997563814f, 0.997550896f,
+    0.997537816f, 0.99752457f, 0.997511156f, 0.997497571f,
+    0.997483811f, 0.997469872f, 0.997455753f, 0.997441447f,
+    0.997426954f, 0.997412268f, 0.997397385f, 0.997382303f,
+    0.997367017f, 0.997351522f, 0.997335815f, 0.997319891f,
+    0.997303747f, 0.997287376f, 0.997270775f, 0.997253939f,
+    0.997236862f, 0.99721954f, 0.997201967f, 0.997184139f,
+    0.997166049f, 0.997147691f, 0.99712906f, 0.99711015f,
+    0.997090955f, 0.997071467f, 0.997051681f, 0.997031589f,
+    0.997011184f, 0.99699046f, 0.996969408f, 0.996948022f,
+    0.996926292f, 0.996904211f, 0.99688177f, 0.99685896f,
+    0.996835772f, 0.996812198f, 0.996788226f, 0.996763848f,
+    0.996739052f, 0.996713829f, 0.996688166f, 0.996662053f,
+    0.996635477f, 0.996608427f, 0.996580889f, 0.99655285f,
+    0.996524296f, 0.996495215f, 0.996465589f, 0.996435405f,
+    0.996404646f, 0.996373296f, 0.996341338f, 0.996308754f,
+    0.996275525f, 0.996241633f, 0.996207057f, 0.996171776f,
+    0.996135769f, 0.996099013f, 0.996061484f, 0.996023159f,
+    0.995984011f, 0.995944014f, 0.99590314f, 0.99586136f,
+    0.995818643f, 0.995774958f, 0.995730271f, 0.995684548f,
+    0.995637753f, 0.995589846f, 0.995540789f, 0.995490539f,
+    0.995439052f, 0.995386283f, 0.995332182f, 0.995276699f,
+    0.99521978f, 0.995161369f, 0.995101406f, 0.995039829f,
+    0.994976571f, 0.994911564f, 0.994844733f, 0.994776f,
+    0.994705284f, 0.994632497f, 0.994557547f, 0.994480337f,
+    0.994400761f, 0.994318711f, 0.994234068f, 0.994146709f,
+    0.994056499f, 0.993963297f, 0.993866953f, 0.993767303f,
+    0.993664175f, 0.993557384f, 0.993446731f, 0.993332002f,
+    0.993212968f, 0.993089381f, 0.992960977f, 0.992827466f,
+    0.992688539f, 0.992543858f, 0.992393058f, 0.992235743f,
+    0.992071481f, 0.991899802f, 0.99172019f, 0.991532082f,
+    0.991334862f, 0.99112785f, 0.990910298f, 0.99068138f,
+    0.990440181f, 0.990185684f, 0.989916759f, 0.989632142f,
+    0.989330418f, 0.989009996f, 0.988669084f, 0.988305649f,
+    0.987917384f, 0.987501654f, 0.987055437f, 0.986575253f,
+    0.986057072f, 0.985496198f, 0.984887131f, 0.984223385f,
+    0.983497255f, 0.982699519f, 0.981819047f, 0.980842281f,
+    0.97975253f, 0.978529019f, 0.97714556f, 0.975568661f,
+    0.973754807f, 0.971646405f, 0.969165616f, 0.966204618f,
+    0.962609688f, 0.958153957f, 0.952488221f, 0.945046065f,
+    0.934844909f, 0.920020638f, 0.896562297f, 0.854006624f,
+    0.753804139f, 0.0f
+};
+
+template <typename real_type, size_t n>
+struct table;
+
+template <>
+struct table<double, 64> {
+  __host__ __device__ static const double * x() {
+    return x_64_d;
+  }
+  __host__ __device__ static const double * y() {
+    return y_64_d;
+  }
+};
+
+template <>
+struct table<float, 64> {
+  __host__ __device__ static const float * x() {
+    return x_64_f;
+  }
+  __host__ __device__ static const float * y() {
+    return y_64_f;
+  }
+};
+
+template <>
+struct table<double, 128> {
+  __host__ __device__ static const double * x() {
+    return x_128_d;
+  }
+  __host__ __device__ static const double * y() {
+    return y_128_d;
+  }
+};
+
+template <>
+struct table<float, 128> {
+  __host__ __device__ static const float * x() {
+    return x_128_f;
+  }
+  __host__ __device__ static const float * y() {
+    return y_128_f;
+  }
+};
+
+template <>
+struct table<double, 256> {
+  __host__ __device__ static const double * x() {
+    return x_256_d;
+  }
+  __host__ __device__ static const double * y() {
+    return y_256_d;
+  }
+};
+
+template <>
+struct table<float, 256> {
+  __host__ __device__ static const float * x() {
+    return x_256_f;
+  }
+  __host__ __device__ static const float * y() {
+    return y_256_f;
+  }
+};
+
+template <>
+struct table<double, 512> {
+  __host__ __device__ static const double * x() {
+    return x_512_d;
+  }
+  __host__ __device__ static const double * y() {
+    return y_512_d;
+  }
+};
+
+template <>
+struct table<float, 512> {
+  __host__ __device__ static const float * x() {
+    return x_512_f;
+  }
+  __host__ __device__ static const float * y() {
+    return y_512_f;
+  }
+};
+
+template <>
+struct table<double, 1024> {
+  __host__ __device__ static const double * x() {
+    return x_1024_d;
+  }
+  __host__ __device__ static const double * y() {
+    return y_1024_d;
+  }
+};
+
+template <>
+struct table<float, 1024> {
+  __host__ __device__ static const float * x() {
+    return x_1024_f;
+  }
+  __host__ __device__ static const float * y() {
+    return y_1024_f;
+  }
+};
+
 }
 }
 }
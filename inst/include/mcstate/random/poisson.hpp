@@ -4,6 +4,7 @@
 
 #include "mcstate/random/cauchy.hpp"
 #include "mcstate/random/generator.hpp"
+#include "mcstate/random/lanes.hpp"
 #include "mcstate/random/numeric.hpp"
 #include "mcstate/random/math.hpp"
 
@@ -53,87 +54,132 @@ real_type poisson_knuth(rng_state_type& rng_state, real_type lambda) {
   return x;
 }
 
-__nv_exec_check_disable__
-template <typename real_type, typename rng_state_type>
-__host__ __device__
-real_type poisson_hormann(rng_state_type& rng_state, real_type lambda) {
-  // Transformed rejection due to Hormann.
-  //
-  // Given a CDF F(x), and G(x), a dominating distribution chosen such
-  // that it is close to the inverse CDF F^-1(x), compute the following
-  // steps:
-  //
-  // 1) Generate U and V, two independent random variates. Set U = U - 0.5
-  // (this step isn't strictly necessary, but is done to make some
-  // calculations symmetric and convenient. Henceforth, G is defined on
-  // [-0.5, 0.5]).
-  //
-  // 2) If V <= alpha * F'(G(U)) * G'(U), return floor(G(U)), else return
-  // to step 1. alpha is the acceptance probability of the rejection
-  // algorithm.
-  //
-  // For more details on transformed rejection, see:
-  // https://doi.org/10.1016/0167-6687(93)90997-4
-  //
-  // The dominating distribution in this case:
-  //
-  // G(u) = (2 * a / (2 - |u|) + b) * u + c
+// Constants used by Hormann's algorithm that depend only on lambda
+template <typename real_type>
+struct hormann_constants {
+  real_type lambda;
+  real_type log_rate;
+  real_type b;
+  real_type a;
+  real_type inv_alpha;
+  real_type v_r;
+};
 
-  int x = 0;
-  const real_type log_rate = mcstate::math::log(lambda);
+// Transformed rejection due to Hormann.
+//
+// Given a CDF F(x), and G(x), a dominating distribution chosen such
+// that it is close to the inverse CDF F^-1(x), compute the following
+// steps:
+//
+// 1) Generate U and V, two independent random variates. Set U = U - 0.5
+// (this step isn't strictly necessary, but is done to make some
+// calculations symmetric and convenient. Henceforth, G is defined on
+// [-0.5, 0.5]).
+//
+// 2) If V <= alpha * F'(G(U)) * G'(U), return floor(G(U)), else return
+// to step 1. alpha is the acceptance probability of the rejection
+// algorithm.
+//
+// For more details on transformed rejection, see:
+// https://doi.org/10.1016/0167-6687(93)90997-4
+//
+// The dominating distribution in this case:
+//
+// G(u) = (2 * a / (2 - |u|) + b) * u + c
+template <typename real_type>
+__host__ __device__
+hormann_constants<real_type> poisson_hormann_setup(real_type lambda) {
+  hormann_constants<real_type> x;
+  x.lambda = lambda;
+  x.log_rate = mcstate::math::log(lambda);
 
   // Constants used to define the dominating distribution. Names taken
   // from Hormann's paper. Constants were chosen to define the tightest
   // G(u) for the inverse Poisson CDF.
-  const real_type b = static_cast<real_type>(0.931) +
+  x.b = static_cast<real_type>(0.931) +
     static_cast<real_type>(2.53) * mcstate::math::sqrt(lambda);
-  const real_type a = static_cast<real_type>(-0.059) +
-    static_cast<real_type>(0.02483) * b;
+  x.a = static_cast<real_type>(-0.059) +
+    static_cast<real_type>(0.02483) * x.b;
 
   // This is the inverse acceptance rate. At a minimum (when rate = 10),
   // this corresponds to ~75% acceptance. As the rate becomes larger, this
   // approaches ~89%.
-  const real_type inv_alpha = static_cast<real_type>(1.1239) +
-    static_cast<real_type>(1.1328) / (b - static_cast<real_type>(3.4));
+  x.inv_alpha = static_cast<real_type>(1.1239) +
+    static_cast<real_type>(1.1328) / (x.b - static_cast<real_type>(3.4));
+
+  // When alpha * f(G(U)) * G'(U) is close to 1, it is possible to
+  // find a rectangle (-u_r, u_r) x (0, v_r) under the curve, such
+  // that if v <= v_r and |u| <= u_r, then we can accept.
+  // Here v_r = 0.9227 - 3.6224 / (b - 2) and u_r = 0.43.
+  x.v_r = static_cast<real_type>(0.9277) -
+    static_cast<real_type>(3.6224) / (x.b - 2);
+  return x;
+}
+
+// The transformation G(u), whose floor is the candidate draw, given u
+// shifted onto [-0.5, 0.5) and u_shifted = 0.5 - |u|
+template <typename real_type>
+__host__ __device__
+inline real_type poisson_hormann_transform(real_type a, real_type b,
+                                           real_type lambda, real_type u,
+                                           real_type u_shifted) {
+  return (2 * a / u_shifted + b) * u + lambda + static_cast<real_type>(0.43);
+}
+
+// Accept without further work inside the rectangle; candidates that
+// would overflow are retried.
+template <typename real_type>
+__host__ __device__
+inline bool poisson_hormann_box(real_type v_r, real_type v,
+                                real_type u_shifted, real_type k) {
+  return (k <= utils::integer_max()) &
+    (u_shifted >= static_cast<real_type>(0.07)) & (v <= v_r);
+}
+
+// The test for a candidate 'k' outside the rectangle; this is the
+// slow path
+template <typename real_type>
+__host__ __device__
+bool poisson_hormann_accept(const hormann_constants<real_type>& x,
+                            real_type v, real_type u_shifted, real_type k) {
+  if (k > utils::integer_max()) {
+    // retry in case of overflow.
+    return false; // # nocov
+  }
 
+  if (k < 0 || (u_shifted < static_cast<real_type>(0.013) && v > u_shifted)) {
+    return false;
+  }
+
+  // The expression below is equivalent to the computation of step 2)
+  // in transformed rejection (v <= alpha * F'(G(u)) * G'(u)).
+  real_type s = mcstate::math::log(v * x.inv_alpha / (x.a / (u_shifted * u_shifted) + x.b));
+  real_type t = -x.lambda + k * x.log_rate -
+    utils::lgamma(static_cast<real_type>(k + 1));
+  return s <= t;
+}
+
+__nv_exec_check_disable__
+template <typename real_type, typename rng_state_type>
+__host__ __device__
+real_type poisson_hormann(rng_state_type& rng_state, real_type lambda) {
+  const auto x = poisson_hormann_setup(lambda);
+  int ret = 0;
   while (true) {
     real_type u = random_real<real_type>(rng_state);
     u -= static_cast<real_type>(0.5);
     real_type v = random_real<real_type>(rng_state);
 
     real_type u_shifted = static_cast<real_type>(0.5) - mcstate::math::abs(u);
-    real_type k = floor((2 * a / u_shifted + b) * u + lambda + static_cast<real_type>(0.43));
-
-    if (k > utils::integer_max()) {
-      // retry in case of overflow.
-      continue; // # nocov
-    }
+    real_type k = std::floor(poisson_hormann_transform(x.a, x.b, lambda, u, u_shifted));
 
-    // When alpha * f(G(U)) * G'(U) is close to 1, it is possible to
-    // find a rectangle (-u_r, u_r) x (0, v_r) under the curve, such
-    // that if v <= v_r and |u| <= u_r, then we can accept.
-    // Here v_r = 0.9227 - 3.6224 / (b - 2) and u_r = 0.43.
-    if (u_shifted >= static_cast<real_type>(0.07) &&
-        v <= static_cast<real_type>(0.9277) - static_cast<real_type>(3.6224) / (b - 2)) {
-      x = k;
-      break;
-    }
-
-    if (k < 0 || (u_shifted < static_cast<real_type>(0.013) && v > u_shifted)) {
-      continue;
-    }
-
-    // The expression below is equivalent to the computation of step 2)
-    // in transformed rejection (v <= alpha * F'(G(u)) * G'(u)).
-    real_type s = mcstate::math::log(v * inv_alpha / (a / (u_shifted * u_shifted) + b));
-    real_type t = -lambda + k * log_rate -
-      utils::lgamma(static_cast<real_type>(k + 1));
-    if (s <= t) {
-      x = k;
+    if (poisson_hormann_box(x.v_r, v, u_shifted, k) ||
+        poisson_hormann_accept(x, v, u_shifted, k)) {
+      ret = k;
       break;
     }
   }
-  return x;
+  return ret;
 }
 
 __nv_exec_check_disable__
@@ -187,6 +233,16 @@ real_type poisson_cauchy(rng_state_type& rng_state, real_type lambda) {
   return result;
 }
 
+// Above this, Poisson draws use rejection based on the Cauchy. This
+// cut-off comes from p 42 of Hormann, and might only be valid for
+// double precision; for single precision we need to check that we can
+// go this high.
+template <typename real_type>
+__host__ __device__
+constexpr real_type poisson_big_lambda() {
+  return std::is_same<real_type, float>::value ? 1e4 : 1e8;
+}
+
 /// Draw a Poisson distributed random number given a mean
 /// parameter. Generation is performed using either Knuth's algorithm
 /// (small lambda) or Hormann's rejection sampling algorithm (medium
@@ -213,11 +269,7 @@ real_type poisson(rng_state_type& rng_state, real_type lambda) {
   static_assert(std::is_floating_point<real_type>::value,
                 "Only valid for floating-point types; use poisson<real_type>()");
 
-  // This cut-off comes from p 42 of Hormann, and might only be
-  // valid for double precision; for single precision we need to
-  // check that we can go this high.
-  constexpr real_type big_lambda =
-    std::is_same<real_type, float>::value ? 1e4 : 1e8;
+  constexpr real_type big_lambda = poisson_big_lambda<real_type>();
 
   poisson_validate(lambda);
   real_type x = 0;
@@ -239,5 +291,95 @@ real_type poisson(rng_state_type& rng_state, real_type lambda) {
   return x;
 }
 
+// Kernel for rejection_lanes(); see btrs_lanes_kernel
+template <typename real_type_, size_t width_>
+class poisson_hormann_lanes_kernel {
+public:
+  using real_type = real_type_;
+  static constexpr size_t width = width_;
+
+  poisson_hormann_lanes_kernel() {
+    std::fill_n(a_, width, 0);
+    std::fill_n(b_, width, 1);
+    std::fill_n(lambda_, width, 0);
+    std::fill_n(v_r_, width, 0);
+  }
+
+  // Only draws that poisson() would pass to poisson_hormann() use the
+  // kernel. The constants are kept from the lane's previous draw if
+  // lambda has not changed, which is the common case
+  template <typename rng_state_type, typename Draws>
+  bool prepare(size_t l, rng_state_type& rng_state, Draws& draws,
+               size_t i, size_t j, real_type& value) {
+    const real_type lambda = draws.lambda(i, j);
+    if (rng_state.deterministic ||
+        !(lambda >= 10 && lambda < poisson_big_lambda<real_type>())) {
+      value = poisson<real_type>(rng_state, lambda);
+      return false;
+    }
+    if (lambda != lambda_[l]) {
+      x_[l] = poisson_hormann_setup(lambda);
+    }
+    a_[l] = x_[l].a;
+    b_[l] = x_[l].b;
+    lambda_[l] = lambda;
+    v_r_[l] = x_[l].v_r;
+    return true;
+  }
+
+  void candidates(const real_type * u, const real_type * v, real_type * us,
+                  real_type * k, real_type * box) const {
+    const real_type half = 0.5;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t l = 0; l < width; ++l) {
+      const real_type u_l = u[l] - half;
+      us[l] = half - mcstate::math::abs(u_l);
+      k[l] = lane_floor(poisson_hormann_transform(a_[l], b_[l], lambda_[l],
+                                                  u_l, us[l]));
+      box[l] = poisson_hormann_box(v_r_[l], v[l], us[l], k[l]) ? 1 : 0;
+    }
+  }
+
+  bool accept(size_t l, real_type v, real_type us, real_type k) const {
+    return poisson_hormann_accept(x_[l], v, us, k);
+  }
+
+  real_type finish(size_t l, real_type k) const {
+    return static_cast<int>(k);
+  }
+
+private:
+  real_type a_[width];
+  real_type b_[width];
+  real_type lambda_[width];
+  real_type v_r_[width];
+  hormann_constants<real_type> x_[width];
+};
+
+/// Draw Poisson distributed random numbers from several streams at
+/// once, running Hormann's rejection sampler (used for moderate
+/// lambda) for `lane_width<real_type>()` streams in lockstep so that
+/// its fast path is vectorised; see `rejection_lanes()`. The draws
+/// from each stream are exactly those that `poisson()` would make.
+///
+/// @tparam real_type The underlying real number type
+///
+/// @param state Pointers to the random number state for each stream,
+///   which will be modified as a side effect
+///
+/// @param n_streams The number of streams
+///
+/// @param draws The draws to make (see `rejection_lanes()`), with
+///   `lambda(i, j)` giving the mean of the `j`th draw from stream `i`
+template <typename real_type, typename rng_state_type, typename Draws>
+void poisson_lanes(rng_state_type * const * state, size_t n_streams,
+                   Draws& draws) {
+  using kernel =
+    poisson_hormann_lanes_kernel<real_type, lane_width<real_type>()>;
+  rejection_lanes<kernel>(state, n_streams, draws);
+}
+
 }
 }
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "mcstate/random/exponential.hpp"
+#include "mcstate/random/gamma.hpp"
+#include "mcstate/random/generator.hpp"
+#include "mcstate/random/poisson.hpp"
+
+namespace mcstate {
+namespace random {
+
+/// Generate the smallest `m` of `n` sorted uniform random numbers on
+/// `(from, to)`, via normalised exponential spacings: if `E_1, ...,
+/// E_{n + 1}` are standard exponentials with partial sums `S_k`, then
+/// `S_1 / S_{n + 1}, ..., S_n / S_{n + 1}` are distributed as `n`
+/// sorted uniforms. Only the first `m` partial sums are needed, as
+/// the remainder `S_{n + 1} - S_m` is a single gamma with shape `n -
+/// m + 1`, so the cost is `O(m)` however large `n` is.
+///
+/// The `m` values returned are then themselves the first `m` event
+/// times of a homogeneous Poisson process on `(from, to)` with `n`
+/// events, and conditional on them the remaining `n - m` events are
+/// sorted uniforms on `(ret[m - 1], to)`, so a long process can be
+/// generated in pieces (see `poisson_process_thinning()`).
+///
+/// In deterministic mode the values are evenly spaced, at `from + k *
+/// (to - from) / (n + 1)` for `k = 1, ..., m`.
+///
+/// @tparam real_type The underlying real number type, typically
+/// `double` or `float`.
+///
+/// @tparam rng_state_type The random number state type
+///
+/// @tparam T The type written to `ret`, which need not be `real_type`
+/// (e.g., `double` when called from R with single precision
+/// generators)
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param n The total number of uniforms (an integer, but held as a
+/// real as it may come from a large Poisson draw)
+///
+/// @param m The number to generate, at most `n`
+///
+/// @param from,to The interval
+///
+/// @param ret Destination, with space for `m` values
+template <typename real_type, typename rng_state_type, typename T>
+void uniform_order_statistics(rng_state_type& rng_state, real_type n, int m,
+                              real_type from, real_type to, T * ret) {
+  if (m <= 0) {
+    return;
+  }
+  T s = 0;
+  for (int k = 0; k < m; ++k) {
+    s += exponential_rand<real_type>(rng_state);
+    ret[k] = s;
+  }
+  const T total = s + gamma<real_type>(rng_state, n - m + 1, 1);
+  const T scale = (to - from) / total;
+  for (int k = 0; k < m; ++k) {
+    ret[k] = from + ret[k] * scale;
+  }
+}
+
+/// Generate the sorted event times of a homogeneous Poisson process
+/// with rate `rate` on the interval `(t_start, t_end)`. The number of
+/// events is drawn first, from a Poisson distribution with mean `rate
+/// * (t_end - t_start)`, and the times are then sorted uniforms (see
+/// `uniform_order_statistics()`), so the number of steps is known in
+/// advance rather than found by testing each event against `t_end`.
+///
+/// If there are more than `n_max` events, only the first `n_max` are
+/// returned; this is exact (they are distributed as the first
+/// `n_max` events of the full process) and costs no more than
+/// generating `n_max` events.
+///
+/// @tparam real_type The underlying real number type, typically
+/// `double` or `float`.
+///
+/// @tparam rng_state_type The random number state type
+///
+/// @tparam T The type written to `ret`
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param rate The rate of the process (non-negative)
+///
+/// @param t_start,t_end The interval, with `t_start <= t_end`
+///
+/// @param n_max The capacity of `ret`
+///
+/// @param ret Destination for the event times, a preallocated buffer
+/// with space for `n_max` values
+///
+/// @return The number of events written to `ret`
+template <typename real_type, typename rng_state_type, typename T>
+int poisson_process(rng_state_type& rng_state, real_type rate,
+                    real_type t_start, real_type t_end, int n_max, T * ret) {
+  if (!(rate >= 0 && std::isfinite(rate)) ||
+      !(t_start <= t_end && std::isfinite(t_start) && std::isfinite(t_end))) {
+    char buffer[256];
+    snprintf(buffer, 256,
+             "Invalid call to poisson_process with rate = %g, interval = (%g, %g)",
+             static_cast<double>(rate), static_cast<double>(t_start),
+             static_cast<double>(t_end));
+    mcstate::utils::fatal_error(buffer);
+  }
+  const real_type n =
+    std::floor(poisson<real_type>(rng_state, rate * (t_end - t_start)));
+  const int m = n < n_max ? static_cast<int>(n) : n_max;
+  uniform_order_statistics<real_type>(rng_state, n, m, t_start, t_end, ret);
+  return m;
+}
+
+/// Generate the sorted event times of an inhomogeneous Poisson
+/// process by thinning (Lewis and Shedler 1979). The rate is given
+/// as a table, interpolated linearly between `len` points `(time[i],
+/// rate[i])`, and the process runs over the range of the table,
+/// `(time[0], time[len - 1])`. Candidate events are generated from a
+/// homogeneous process at the largest rate in the table, and each is
+/// kept with probability given by the ratio of the rate at its time
+/// to that maximum. Because the candidates are sorted, the position
+/// in the table is found by walking forward.
+///
+/// The candidates are generated directly into `ret`, up to its
+/// remaining capacity at a time, and thinned in place; if that
+/// leaves space, the next candidates follow on from the last one.
+/// As for `poisson_process()`, if there are more than `n_max` events
+/// only the first `n_max` are returned.
+///
+/// In deterministic mode the candidates are evenly spaced, and a
+/// candidate is kept whenever the running sum of the acceptance
+/// probabilities passes an integer.
+///
+/// @tparam real_type The underlying real number type, typically
+/// `double` or `float`.
+///
+/// @tparam rng_state_type The random number state type
+///
+/// @tparam T,U The type of the containers for `time` and `rate`, and
+/// the type written to `ret`
+///
+/// @param rng_state Reference to the random number state, will be
+/// modified as a side-effect
+///
+/// @param time The times of the table, strictly increasing
+///
+/// @param rate The rates at each time in `time` (non-negative)
+///
+/// @param len The number of points in the table (at least 2)
+///
+/// @param n_max The capacity of `ret`
+///
+/// @param ret Destination for the event times, a preallocated buffer
+/// with space for `n_max` values
+///
+/// @return The number of events written to `ret`
+template <typename real_type, typename rng_state_type,
+          typename T, typename U>
+int poisson_process_thinning(rng_state_type& rng_state, const T& time,
+                             const T& rate, int len, int n_max, U * ret) {
+  if (len < 2) {
+    mcstate::utils::fatal_error(
+      "Invalid call to poisson_process_thinning; need at least 2 rates");
+  }
+  real_type rate_max = 0;
+  for (int i = 0; i < len; ++i) {
+    if (!(rate[i] >= 0 && std::isfinite(rate[i])) ||
+        !std::isfinite(time[i]) || (i > 0 && !(time[i] > time[i - 1]))) {
+      char buffer[256];
+      snprintf(buffer, 256,
+               "Invalid call to poisson_process_thinning with time = %g, rate = %g (entry %d)",
+               static_cast<double>(time[i]), static_cast<double>(rate[i]),
+               i + 1);
+      mcstate::utils::fatal_error(buffer);
+    }
+    rate_max = std::max(rate_max, static_cast<real_type>(rate[i]));
+  }
+
+  const real_type t_end = time[len - 1];
+  real_type from = time[0];
+  real_type n_left =
+    std::floor(poisson<real_type>(rng_state, rate_max * (t_end - from)));
+  int n_accepted = 0;
+  int i = 0;
+  real_type p_sum = 0;
+  while (n_left > 0 && n_accepted < n_max) {
+    U * candidate = ret + n_accepted;
+    const int m = n_left < n_max - n_accepted ?
+      static_cast<int>(n_left) : n_max - n_accepted;
+    uniform_order_statistics<real_type>(rng_state, n_left, m, from, t_end,
+                                        candidate);
+    from = candidate[m - 1];
+    n_left -= m;
+    // Accepted events are written back over the candidates; the
+    // write position never passes the read position
+    for (int k = 0; k < m; ++k) {
+      const real_type t = candidate[k];
+      while (i < len - 2 && time[i + 1] < t) {
+        ++i;
+      }
+      const real_type r = rate[i] + (rate[i + 1] - rate[i]) *
+        (t - time[i]) / (time[i + 1] - time[i]);
+      bool accept;
+      if (rng_state.deterministic) {
+        p_sum += r / rate_max;
+        accept = p_sum >= 1;
+        p_sum -= accept;
+      } else {
+        accept = random_real<real_type>(rng_state) * rate_max < r;
+      }
+      if (accept) {
+        ret[n_accepted] = t;
+        ++n_accepted;
+      }
+    }
+  }
+  return n_accepted;
+}
+
+}
+}
@@ -3,15 +3,19 @@
 #include "mcstate/random/generator.hpp"
 #include "mcstate/random/prng.hpp"
 
+#include "mcstate/random/beta_binomial.hpp"
 #include "mcstate/random/binomial.hpp"
 #include "mcstate/random/cauchy.hpp"
 #include "mcstate/random/exponential.hpp"
 #include "mcstate/random/gamma.hpp"
 #include "mcstate/random/hypergeometric.hpp"
+#include "mcstate/random/integer.hpp"
 #include "mcstate/random/multinomial.hpp"
+#include "mcstate/random/multivariate_hypergeometric.hpp"
 #include "mcstate/random/nbinomial.hpp"
 #include "mcstate/random/normal.hpp"
 #include "mcstate/random/poisson.hpp"
+#include "mcstate/random/poisson_process.hpp"
 #include "mcstate/random/uniform.hpp"
 
 #include "mcstate/random/version.hpp"
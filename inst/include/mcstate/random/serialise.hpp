@@ -0,0 +1,409 @@
+#pragma once
+
+// Compact binary serialisation of the state of a set of random
+// number streams, for checkpointing. The format is a fixed-size
+// header (see `state_header`), an optional bitmap of per-stream
+// "deterministic" flags (omitted when all streams agree, which is
+// almost always the case) and then the raw state, in stream order.
+//
+// The state is written in native byte order; the version field will
+// fail to validate if read on a machine with different endianness.
+//
+// Files are read by mapping them into memory where this is supported
+// (everywhere but Windows), so that importing a very large set of
+// streams does not need an intermediate copy of the file.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "mcstate/random/generator.hpp"
+#include "mcstate/random/prng.hpp"
+
+namespace mcstate {
+namespace random {
+
+template<typename T>
+std::string algorithm_name() {
+  std::string ret;
+  if (std::is_same<T, xoshiro128plus>::value) {
+    ret = "xoshiro128plus";
+  } else if (std::is_same<T, xoshiro128plusplus>::value) {
+    ret = "xoshiro128plusplus";
+  } else if (std::is_same<T, xoshiro128starstar>::value) {
+    ret = "xoshiro128starstar";
+  } else if (std::is_same<T, xoroshiro128plus>::value) {
+    ret = "xoroshiro128plus";
+  } else if (std::is_same<T, xoroshiro128plusplus>::value) {
+    ret = "xoroshiro128plusplus";
+  } else if (std::is_same<T, xoroshiro128starstar>::value) {
+    ret = "xoroshiro128starstar";
+  } else if (std::is_same<T, xoshiro256plus>::value) {
+    ret = "xoshiro256plus";
+  } else if (std::is_same<T, xoshiro256plusplus>::value) {
+    ret = "xoshiro256plusplus";
+  } else if (std::is_same<T, xoshiro256starstar>::value) {
+    ret = "xoshiro256starstar";
+  } else if (std::is_same<T, xoshiro512plus>::value) {
+    ret = "xoshiro512plus";
+  } else if (std::is_same<T, xoshiro512plusplus>::value) {
+    ret = "xoshiro512plusplus";
+  } else if (std::is_same<T, xoshiro512starstar>::value) {
+    ret = "xoshiro512starstar";
+  }
+  return ret;
+}
+
+namespace serialise {
+
+constexpr uint32_t version = 1;
+
+// All streams are deterministic
+constexpr uint32_t flag_deterministic = 1;
+// A bitmap of per-stream deterministic flags follows the header
+constexpr uint32_t flag_bitmap = 2;
+
+struct state_header {
+  char magic[4];
+  uint32_t version;
+  char algorithm[24];
+  uint64_t n_streams;
+  uint32_t state_size;
+  uint32_t int_size;
+  uint32_t flags;
+  uint32_t unused;
+};
+
+static_assert(sizeof(state_header) % 8 == 0,
+              "state_header must preserve alignment of the state");
+
+inline size_t bitmap_size(size_t n_streams) {
+  // Padded so that the state that follows stays aligned
+  return ((n_streams + 63) / 64) * 8;
+}
+
+inline size_t len_bitmap(const state_header& header) {
+  return header.flags & flag_bitmap ? bitmap_size(header.n_streams) : 0;
+}
+
+#ifdef _WIN32
+/// Read the whole of a file
+inline std::vector<unsigned char> read_file(const std::string& filename) {
+  FILE * f = std::fopen(filename.c_str(), "rb");
+  if (f == nullptr) {
+    throw std::runtime_error("Failed to open '" + filename + "'");
+  }
+  std::vector<unsigned char> data;
+  unsigned char buffer[4096];
+  size_t n;
+  while ((n = std::fread(buffer, 1, sizeof(buffer), f)) > 0) {
+    data.insert(data.end(), buffer, buffer + n);
+  }
+  std::fclose(f);
+  return data;
+}
+#else
+/// A file mapped into memory, unmapped on destruction
+class mapped_file {
+public:
+  /// Map a file
+  ///
+  /// @param filename The file to map
+  ///
+  /// @param writable Map the file so that changes are written back
+  /// to it, and are visible to other processes mapping the same file
+  mapped_file(const std::string& filename, bool writable) {
+    const int fd = open(filename.c_str(), writable ? O_RDWR : O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Failed to open '" + filename + "'");
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+      close(fd);
+      throw std::runtime_error("Failed to read '" + filename + "'");
+    }
+    size_ = st.st_size;
+    data_ = mmap(nullptr, size_,
+                 writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                 writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data_ == MAP_FAILED) {
+      throw std::runtime_error("Failed to map '" + filename + "'");
+    }
+  }
+
+  ~mapped_file() {
+    munmap(data_, size_);
+  }
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  unsigned char * data() const {
+    return static_cast<unsigned char*>(data_);
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  /// Flush changes to the file
+  void sync() {
+    msync(data_, size_, MS_SYNC);
+  }
+
+private:
+  void * data_;
+  size_t size_;
+};
+#endif
+
+}
+
+/// Compute the size, in bytes, of the serialised state of `rng`
+template <typename T>
+size_t serialise_size(prng<T>& rng) {
+  size_t ret = sizeof(serialise::state_header) +
+    rng.size() * T::size() * sizeof(typename T::int_type);
+  for (size_t i = 1; i < rng.size(); ++i) {
+    if (rng.state(i).deterministic != rng.state(0).deterministic) {
+      ret += serialise::bitmap_size(rng.size());
+      break;
+    }
+  }
+  return ret;
+}
+
+/// Serialise the state of `rng` into `dest`, which must have space
+/// for `serialise_size(rng)` bytes.
+template <typename T>
+void serialise_state(prng<T>& rng, unsigned char * dest) {
+  using int_type = typename T::int_type;
+  const size_t n_streams = rng.size();
+
+  bool mixed = false;
+  for (size_t i = 1; i < n_streams; ++i) {
+    if (rng.state(i).deterministic != rng.state(0).deterministic) {
+      mixed = true;
+      break;
+    }
+  }
+
+  serialise::state_header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, "MCSR", 4);
+  header.version = serialise::version;
+  const auto name = algorithm_name<T>();
+  std::memcpy(header.algorithm, name.c_str(), name.size());
+  header.n_streams = n_streams;
+  header.state_size = T::size();
+  header.int_size = sizeof(int_type);
+  if (mixed) {
+    header.flags = serialise::flag_bitmap;
+  } else if (n_streams > 0 && rng.state(0).deterministic) {
+    header.flags = serialise::flag_deterministic;
+  }
+  std::memcpy(dest, &header, sizeof(header));
+  dest += sizeof(header);
+
+  if (mixed) {
+    const size_t len = serialise::bitmap_size(n_streams);
+    std::memset(dest, 0, len);
+    for (size_t i = 0; i < n_streams; ++i) {
+      if (rng.state(i).deterministic) {
+        dest[i / 8] |= 1 << (i % 8);
+      }
+    }
+    dest += len;
+  }
+
+  constexpr size_t len = T::size() * sizeof(int_type);
+  for (size_t i = 0; i < n_streams; ++i, dest += len) {
+    std::memcpy(dest, rng.state(i).state, len);
+  }
+}
+
+/// Serialise the state of `rng` into a vector of bytes
+template <typename T>
+std::vector<unsigned char> serialise_state(prng<T>& rng) {
+  std::vector<unsigned char> ret(serialise_size(rng));
+  serialise_state(rng, ret.data());
+  return ret;
+}
+
+namespace serialise {
+
+/// Validate serialised state, returning its header
+///
+/// @param src Pointer to the serialised data
+///
+/// @param len The number of bytes available at `src`
+template <typename T>
+state_header validate(const unsigned char * src, size_t len) {
+  using int_type = typename T::int_type;
+  state_header header;
+  if (len < sizeof(header)) {
+    throw std::runtime_error("Serialised rng state is too short");
+  }
+  std::memcpy(&header, src, sizeof(header));
+  if (std::memcmp(header.magic, "MCSR", 4) != 0) {
+    throw std::runtime_error("Data is not serialised rng state");
+  }
+  if (header.version != version) {
+    throw std::runtime_error("Unsupported serialised rng state version");
+  }
+  const auto name = algorithm_name<T>();
+  size_t len_name = 0;
+  while (len_name < sizeof(header.algorithm) && header.algorithm[len_name]) {
+    ++len_name;
+  }
+  const auto name_given = std::string(header.algorithm, len_name);
+  if (name_given != name || header.state_size != T::size() ||
+      header.int_size != sizeof(int_type)) {
+    throw std::runtime_error("Incorrect rng type: given " + name_given +
+                             ", expected " + name);
+  }
+  // Bound the number of streams by the data available before
+  // computing the expected length, which could otherwise overflow
+  constexpr size_t len_stream = T::size() * sizeof(int_type);
+  const size_t len_data = len - sizeof(header);
+  if (header.n_streams > len_data / len_stream ||
+      len_data != len_bitmap(header) + header.n_streams * len_stream) {
+    throw std::runtime_error("Serialised rng state has incorrect length");
+  }
+  return header;
+}
+
+/// Copy validated serialised state into `rng`, which must have
+/// `header.n_streams` streams
+template <typename T>
+void import_state(const unsigned char * src, const state_header& header,
+                  prng<T>& rng) {
+  using int_type = typename T::int_type;
+  const unsigned char * bitmap = src + sizeof(header);
+  const auto * state = reinterpret_cast<const int_type*>(
+    bitmap + len_bitmap(header));
+  rng.import_state(state);
+  const bool deterministic = header.flags & flag_deterministic;
+  const bool mixed = header.flags & flag_bitmap;
+  for (size_t i = 0; i < rng.size(); ++i) {
+    rng.state(i).deterministic =
+      mixed ? (bitmap[i / 8] >> (i % 8)) & 1 : deterministic;
+  }
+}
+
+inline std::string incorrect_streams(const std::string& where,
+                                     size_t given, size_t expected) {
+  return "Incorrect number of streams" + where + ": given " +
+    std::to_string(given) + ", expected " + std::to_string(expected);
+}
+
+}
+
+/// Restore a `prng` object from state written by `serialise_state`.
+///
+/// @param src Pointer to the serialised data
+///
+/// @param len The number of bytes available at `src`
+template <typename T>
+prng<T> deserialise_state(const unsigned char * src, size_t len) {
+  using int_type = typename T::int_type;
+  const auto header = serialise::validate<T>(src, len);
+  const size_t n_streams = header.n_streams;
+  const unsigned char * bitmap = src + sizeof(header);
+  const auto * state = reinterpret_cast<const int_type*>(
+    bitmap + serialise::len_bitmap(header));
+
+  const bool deterministic = header.flags & serialise::flag_deterministic;
+  prng<T> ret(n_streams,
+              std::vector<int_type>(state, state + n_streams * T::size()),
+              deterministic);
+  if (header.flags & serialise::flag_bitmap) {
+    for (size_t i = 0; i < n_streams; ++i) {
+      ret.state(i).deterministic = (bitmap[i / 8] >> (i % 8)) & 1;
+    }
+  }
+  return ret;
+}
+
+/// Restore the state of an existing `prng` object from state written
+/// by `serialise_state`, copying it directly from `src`. The number
+/// of streams must match.
+///
+/// @param src Pointer to the serialised data
+///
+/// @param len The number of bytes available at `src`
+///
+/// @param rng The object to update
+template <typename T>
+void deserialise_state(const unsigned char * src, size_t len, prng<T>& rng) {
+  const auto header = serialise::validate<T>(src, len);
+  if (header.n_streams != rng.size()) {
+    throw std::runtime_error(
+      serialise::incorrect_streams("", header.n_streams, rng.size()));
+  }
+  serialise::import_state(src, header, rng);
+}
+
+/// Write the state of `rng` to the file `filename`
+template <typename T>
+void save_state(prng<T>& rng, const std::string& filename) {
+  const auto data = serialise_state(rng);
+  FILE * f = std::fopen(filename.c_str(), "wb");
+  if (f == nullptr) {
+    throw std::runtime_error("Failed to open '" + filename + "' for writing");
+  }
+  const size_t n = std::fwrite(data.data(), 1, data.size(), f);
+  const bool ok = std::fclose(f) == 0 && n == data.size();
+  if (!ok) {
+    throw std::runtime_error("Failed to write rng state to '" +
+                             filename + "'");
+  }
+}
+
+/// Read the state written by `save_state` from the file `filename`
+template <typename T>
+prng<T> load_state(const std::string& filename) {
+#ifdef _WIN32
+  const auto data = serialise::read_file(filename);
+  return deserialise_state<T>(data.data(), data.size());
+#else
+  serialise::mapped_file data(filename, false);
+  return deserialise_state<T>(data.data(), data.size());
+#endif
+}
+
+/// Read the state written by `save_state` from the file `filename`
+/// into an existing `prng` object, which must have the same number
+/// of streams. The state is copied straight from the file (mapped
+/// into memory where possible) into `rng`, and `rng` is unchanged if
+/// the file is not valid.
+template <typename T>
+void load_state(const std::string& filename, prng<T>& rng) {
+#ifdef _WIN32
+  const auto data = serialise::read_file(filename);
+#else
+  const serialise::mapped_file data(filename, false);
+#endif
+  const auto header = serialise::validate<T>(data.data(), data.size());
+  if (header.n_streams != rng.size()) {
+    throw std::runtime_error(
+      serialise::incorrect_streams(" in '" + filename + "'",
+                                   header.n_streams, rng.size()));
+  }
+  serialise::import_state(data.data(), header, rng);
+}
+
+}
+}
@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+#include <mcstate/random/random.hpp>
+
+// Time 'n_draws' negative binomial draws with the given size and
+// mean, by inversion or as a gamma-Poisson mixture, returning the best
+// time per draw (in ns) over 'n_reps' repeats
+template <typename real_type>
+double time_nbinomial(real_type size, real_type mu, bool inversion,
+                      size_t n_draws, int n_reps) {
+  using rng_state_type = mcstate::random::generator<real_type>;
+  mcstate::random::prng<rng_state_type> rng(1, 42, false);
+  auto& state = rng.state(0);
+  const real_type p0 = std::exp(-size * std::log1p(mu / size));
+  const real_type q = mu / (size + mu);
+  double best = 0;
+  volatile real_type sink = 0;
+  for (int rep = 0; rep < n_reps; ++rep) {
+    real_type tot = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    if (inversion) {
+      for (size_t i = 0; i < n_draws; ++i) {
+        tot += mcstate::random::nbinomial_inversion(state, size, p0, q);
+      }
+    } else {
+      for (size_t i = 0; i < n_draws; ++i) {
+        tot += mcstate::random::poisson(
+          state, mcstate::random::gamma(state, size, mu / size));
+      }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    sink = sink + tot;
+    const double t = std::chrono::duration<double, std::nano>(t1 - t0).count();
+    if (rep == 0 || t < best) {
+      best = t;
+    }
+  }
+  return best / n_draws;
+}
+
+// For each size, time both methods over a range of means and report
+// the smallest mean at which the mixture is faster
+template <typename real_type>
+void crossover(const char * name, size_t n_draws, int n_reps) {
+  const real_type sizes[] = {0.5, 1, 5, 20, 100};
+  const real_type means[] = {1, 2, 5, 10, 15, 20, 25, 30, 35, 40, 50, 60, 80};
+  for (auto size : sizes) {
+    real_type cross = NAN;
+    for (auto mu : means) {
+      const double t_inv =
+        time_nbinomial<real_type>(size, mu, true, n_draws, n_reps);
+      const double t_mix =
+        time_nbinomial<real_type>(size, mu, false, n_draws, n_reps);
+      std::cout << std::setw(7) << name << std::setw(7) << size <<
+        std::setw(5) << mu << std::fixed << std::setprecision(1) <<
+        std::setw(11) << t_inv << std::setw(15) << t_mix << " ns/draw" <<
+        std::defaultfloat << std::setprecision(6) << std::endl;
+      if (std::isnan(cross) && t_mix < t_inv) {
+        cross = mu;
+      }
+    }
+    std::cout << std::setw(7) << name << std::setw(7) << size <<
+      "  gamma-Poisson faster from mean " << cross << std::endl << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  size_t n_draws = argc < 2 ? 1000000 : atol(argv[1]);
+  int n_reps     = argc < 3 ?       3 : atoi(argv[2]);
+
+  std::cout << "   type   size mean  inversion  gamma-Poisson" << std::endl;
+  crossover<double>("double", n_draws, n_reps);
+  crossover<float>("float", n_draws, n_reps);
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+
+#include <mcstate/random/random.hpp>
+
+using rng_state_type = mcstate::random::generator<double>;
+using rng_type = mcstate::random::prng<rng_state_type>;
+
+// A set of streams, each making 'n_draws' draws with its own
+// parameters; the cost of a draw depends on the parameters
+struct workload {
+  std::string name;
+  size_t n_draws;
+  std::vector<double> a;
+  std::vector<double> b;
+};
+
+struct schedule {
+  std::string name;
+  omp_sched_t kind;
+  int chunk;
+};
+
+// This matches 'dynamic_chunk_size' in the package's random.cpp
+int dynamic_chunk_size(size_t n_work, int n_threads) {
+  constexpr size_t chunks_per_thread = 16;
+  return std::max<size_t>(
+    1, n_work / (chunks_per_thread * std::max(n_threads, 1)));
+}
+
+struct draw_poisson {
+  double operator()(rng_state_type& state, double lambda, double) const {
+    return mcstate::random::poisson<double>(state, lambda);
+  }
+};
+
+struct draw_binomial {
+  double operator()(rng_state_type& state, double size, double prob) const {
+    return mcstate::random::binomial<double>(state, size, prob);
+  }
+};
+
+// Best time (in ms) over 'n_reps' repeats of drawing the workload
+// with the schedule 's', set through schedule(runtime)
+template <typename Draw>
+double time_workload(const workload& w, const schedule& s, int n_threads,
+                     int n_reps, Draw draw) {
+  const size_t n_streams = w.a.size();
+  std::vector<double> tot(n_streams);
+  omp_set_schedule(s.kind, s.chunk);
+  double best = 0;
+  for (int rep = 0; rep < n_reps; ++rep) {
+    rng_type rng(n_streams, 42, false);
+    const auto t0 = std::chrono::steady_clock::now();
+#pragma omp parallel for schedule(runtime) num_threads(n_threads)
+    for (size_t i = 0; i < n_streams; ++i) {
+      auto& state = rng.state(i);
+      double tot_i = 0;
+      for (size_t j = 0; j < w.n_draws; ++j) {
+        tot_i += draw(state, w.a[i], w.b[i]);
+      }
+      tot[i] = tot_i;
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    const double t = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    if (rep == 0 || t < best) {
+      best = t;
+    }
+  }
+  return best;
+}
+
+// A few long streams, a quarter of them expensive and all of those
+// first, which is the worst case for static scheduling
+workload mixed(double expensive, double cheap, double b) {
+  const size_t n_streams = 64;
+  workload w{"64 x 20000 mixed", 20000,
+             std::vector<double>(n_streams, cheap),
+             std::vector<double>(n_streams, b)};
+  std::fill_n(w.a.begin(), n_streams / 4, expensive);
+  return w;
+}
+
+// Many short streams with parameters spread over [0, to)
+workload many(double to, double b) {
+  const size_t n_streams = 200000;
+  workload w{"200000 x 4 spread", 4,
+             std::vector<double>(n_streams),
+             std::vector<double>(n_streams, b)};
+  rng_type rng(1, 1, false);
+  for (auto& x : w.a) {
+    x = mcstate::random::random_real<double>(rng.state(0)) * to;
+  }
+  return w;
+}
+
+template <typename Draw>
+void run(const char * name, const std::vector<workload>& workloads,
+         bool a_is_prob, int n_threads, int n_reps, Draw draw) {
+  for (auto w : workloads) {
+    if (a_is_prob) {
+      std::swap(w.a, w.b);
+    }
+    const size_t n_streams = w.a.size();
+    const std::vector<schedule> schedules{
+      {"static", omp_sched_static, 0},
+      {"dynamic", omp_sched_dynamic, 1},
+      {"dynamic,chunk", omp_sched_dynamic,
+       dynamic_chunk_size(n_streams, n_threads)},
+      {"guided", omp_sched_guided, 1}};
+    for (const auto& s : schedules) {
+      std::cout << std::setw(9) << name << std::setw(20) << w.name <<
+        std::setw(15) << s.name << std::setw(7) << s.chunk <<
+        std::setw(10) << std::fixed << std::setprecision(2) <<
+        time_workload(w, s, n_threads, n_reps, draw) << " ms" << std::endl;
+    }
+  }
+}
+
+int main(int argc, char* argv[]) {
+  int n_threads = argc < 2 ? omp_get_max_threads() : atoi(argv[1]);
+  int n_reps    = argc < 3 ?                     5 : atoi(argv[2]);
+
+  std::cout << "Using " << n_threads << " threads" << std::endl;
+
+  // Knuth's algorithm costs about lambda + 1 uniforms per draw, up to
+  // the switch to Hormann's at lambda = 10
+  run("poisson", {mixed(9.5, 0.5, 0), many(10, 0)}, false,
+      n_threads, n_reps, draw_poisson());
+  // Inversion costs about 'size * prob' steps per draw; here the
+  // parameters are generated as probabilities and the size fixed
+  run("binomial", {mixed(0.095, 0.005, 100), many(0.1, 100)}, true,
+      n_threads, n_reps, draw_binomial());
+  return 0;
+}
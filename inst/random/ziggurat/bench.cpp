@@ -0,0 +1,65 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include <mcstate/random/random.hpp>
+
+// Time 'n_draws' ziggurat draws with 'n' layers, returning the best
+// time per draw (in ns) over 'n_reps' repeats
+template <typename real_type, size_t n>
+double time_ziggurat(size_t n_draws, int n_reps) {
+  using rng_state_type = mcstate::random::generator<real_type>;
+  mcstate::random::prng<rng_state_type> rng(1, 42, false);
+  auto& state = rng.state(0);
+  double best = 0;
+  volatile real_type sink = 0;
+  for (int rep = 0; rep < n_reps; ++rep) {
+    real_type tot = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n_draws; ++i) {
+      tot += mcstate::random::random_normal_ziggurat<real_type, n>(state);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    sink = sink + tot;
+    const double t = std::chrono::duration<double, std::nano>(t1 - t0).count();
+    if (rep == 0 || t < best) {
+      best = t;
+    }
+  }
+  return best / n_draws;
+}
+
+template <typename real_type>
+size_t best_layers(const char * name, size_t n_draws, int n_reps) {
+  const size_t layers[] = {64, 128, 256, 512, 1024};
+  const double t[] = {
+    time_ziggurat<real_type, 64>(n_draws, n_reps),
+    time_ziggurat<real_type, 128>(n_draws, n_reps),
+    time_ziggurat<real_type, 256>(n_draws, n_reps),
+    time_ziggurat<real_type, 512>(n_draws, n_reps),
+    time_ziggurat<real_type, 1024>(n_draws, n_reps)
+  };
+  size_t best = 0;
+  for (size_t i = 0; i < 5; ++i) {
+    std::cout << std::setw(8) << name << std::setw(6) << layers[i] <<
+      std::setw(10) << std::fixed << std::setprecision(3) << t[i] <<
+      " ns/draw" << std::endl;
+    if (t[i] < t[best]) {
+      best = i;
+    }
+  }
+  return layers[best];
+}
+
+int main(int argc, char* argv[]) {
+  size_t n_draws = argc < 2 ? 10000000 : atol(argv[1]);
+  int n_reps     = argc < 3 ?        5 : atoi(argv[2]);
+
+  const auto best_double = best_layers<double>("double", n_draws, n_reps);
+  const auto best_float = best_layers<float>("float", n_draws, n_reps);
+
+  std::cout << std::endl << "Fastest on this machine; compile with" <<
+    std::endl << "  -DMCSTATE_ZIGGURAT_LAYERS_DOUBLE=" << best_double <<
+    " -DMCSTATE_ZIGGURAT_LAYERS_FLOAT=" << best_float << std::endl;
+  return 0;
+}
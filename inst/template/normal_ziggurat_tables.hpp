@@ -1,25 +1,26 @@
 #pragma once
 // Generated by scripts/update_ziggurat_tables - do not edit
 
-#include "mcstate/random/cuda_compatibility.hpp"
+#include <cstddef>
 
-#ifndef MCSTATE_ZIGGURAT_REAL_TYPE
-#define MCSTATE_ZIGGURAT_REAL_TYPE double
-#endif
+#include "mcstate/random/cuda_compatibility.hpp"
 
 namespace mcstate {
 namespace random {
 namespace ziggurat {
 
-CONSTANT
-MCSTATE_ZIGGURAT_REAL_TYPE x[257] = {
-{{x}}
-};
+// For an n-layer ziggurat, 'x' (length n + 1) holds the layer
+// boundaries, starting with the base (the tail start divided by
+// its density), and 'y' (length n) the ratio of each boundary to the
+// one below it. Tables are given for 64 to 1024 layers, in each
+// precision; access them through 'table<real_type, n>'.
+
+{{tables}}
+
+template <typename real_type, size_t n>
+struct table;
 
-CONSTANT
-MCSTATE_ZIGGURAT_REAL_TYPE y[256] = {
-{{y}}
-};
+{{specialisations}}
 
 }
 }
@@ -5,6 +5,41 @@
 #include "cpp11/declarations.hpp"
 #include <R_ext/Visibility.h>
 
+// packer.cpp
+SEXP mcstate_packer_unpack(cpp11::list layout, cpp11::doubles x, cpp11::sexp prev);
+extern "C" SEXP _mcstate2_mcstate_packer_unpack(SEXP layout, SEXP x, SEXP prev) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_packer_unpack(cpp11::as_cpp<cpp11::decay_t<cpp11::list>>(layout), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(x), cpp11::as_cpp<cpp11::decay_t<cpp11::sexp>>(prev)));
+  END_CPP11
+}
+// packer.cpp
+cpp11::writable::doubles mcstate_packer_pack(cpp11::list p, int len);
+extern "C" SEXP _mcstate2_mcstate_packer_pack(SEXP p, SEXP len) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_packer_pack(cpp11::as_cpp<cpp11::decay_t<cpp11::list>>(p), cpp11::as_cpp<cpp11::decay_t<int>>(len)));
+  END_CPP11
+}
+// particle.cpp
+cpp11::sexp mcstate_rng_resample(SEXP ptr, cpp11::doubles r_log_weights, std::string method, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_resample(SEXP ptr, SEXP r_log_weights, SEXP method, SEXP n_threads, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_resample(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_log_weights), cpp11::as_cpp<cpp11::decay_t<std::string>>(method), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// particle.cpp
+cpp11::sexp mcstate_log_weights_summary(cpp11::doubles w, int n_threads);
+extern "C" SEXP _mcstate2_mcstate_log_weights_summary(SEXP w, SEXP n_threads) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_log_weights_summary(cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(w), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads)));
+  END_CPP11
+}
+// particle.cpp
+cpp11::sexp mcstate_log_weights_normalise(cpp11::doubles w, int n_threads);
+extern "C" SEXP _mcstate2_mcstate_log_weights_normalise(SEXP w, SEXP n_threads) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_log_weights_normalise(cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(w), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads)));
+  END_CPP11
+}
 // random.cpp
 SEXP mcstate_rng_alloc(cpp11::sexp r_seed, int n_streams, bool deterministic, bool is_float);
 extern "C" SEXP _mcstate2_mcstate_rng_alloc(SEXP r_seed, SEXP n_streams, SEXP deterministic, SEXP is_float) {
@@ -29,80 +64,94 @@ extern "C" SEXP _mcstate2_mcstate_rng_long_jump(SEXP ptr, SEXP is_float) {
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_random_real(SEXP ptr, int n, int n_threads, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_random_real(SEXP ptr, SEXP n, SEXP n_threads, SEXP is_float) {
+cpp11::sexp mcstate_rng_random_real(SEXP ptr, int n, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_random_real(SEXP ptr, SEXP n, SEXP n_threads, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_random_real(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_random_real(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_random_normal(SEXP ptr, int n, int n_threads, std::string algorithm, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_random_normal(SEXP ptr, SEXP n, SEXP n_threads, SEXP algorithm, SEXP is_float) {
+cpp11::sexp mcstate_rng_random_normal(SEXP ptr, int n, int n_threads, std::string algorithm, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_random_normal(SEXP ptr, SEXP n, SEXP n_threads, SEXP algorithm, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_random_normal(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<std::string>>(algorithm), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_random_normal(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<std::string>>(algorithm), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_uniform(SEXP ptr, int n, cpp11::doubles r_min, cpp11::doubles r_max, int n_threads, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_uniform(SEXP ptr, SEXP n, SEXP r_min, SEXP r_max, SEXP n_threads, SEXP is_float) {
+cpp11::sexp mcstate_rng_uniform(SEXP ptr, int n, cpp11::doubles r_min, cpp11::doubles r_max, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_uniform(SEXP ptr, SEXP n, SEXP r_min, SEXP r_max, SEXP n_threads, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_uniform(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_min), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_max), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_uniform(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_min), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_max), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_exponential(SEXP ptr, int n, cpp11::doubles r_rate, int n_threads, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_exponential(SEXP ptr, SEXP n, SEXP r_rate, SEXP n_threads, SEXP is_float) {
+cpp11::sexp mcstate_rng_exponential(SEXP ptr, int n, cpp11::doubles r_rate, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_exponential(SEXP ptr, SEXP n, SEXP r_rate, SEXP n_threads, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_exponential(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_rate), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_exponential(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_rate), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_normal(SEXP ptr, int n, cpp11::doubles r_mean, cpp11::doubles r_sd, int n_threads, std::string algorithm, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_normal(SEXP ptr, SEXP n, SEXP r_mean, SEXP r_sd, SEXP n_threads, SEXP algorithm, SEXP is_float) {
+cpp11::sexp mcstate_rng_normal(SEXP ptr, int n, cpp11::doubles r_mean, cpp11::doubles r_sd, int n_threads, std::string algorithm, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_normal(SEXP ptr, SEXP n, SEXP r_mean, SEXP r_sd, SEXP n_threads, SEXP algorithm, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_normal(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_mean), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_sd), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<std::string>>(algorithm), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_normal(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_mean), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_sd), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<std::string>>(algorithm), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_binomial(SEXP ptr, int n, cpp11::doubles r_size, cpp11::doubles r_prob, int n_threads, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_binomial(SEXP ptr, SEXP n, SEXP r_size, SEXP r_prob, SEXP n_threads, SEXP is_float) {
+cpp11::sexp mcstate_rng_binomial(SEXP ptr, int n, cpp11::doubles r_size, cpp11::doubles r_prob, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_binomial(SEXP ptr, SEXP n, SEXP r_size, SEXP r_prob, SEXP n_threads, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_binomial(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_size), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_prob), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_binomial(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_size), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_prob), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_nbinomial(SEXP ptr, int n, cpp11::doubles r_size, cpp11::doubles r_prob, int n_threads, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_nbinomial(SEXP ptr, SEXP n, SEXP r_size, SEXP r_prob, SEXP n_threads, SEXP is_float) {
+cpp11::sexp mcstate_rng_nbinomial(SEXP ptr, int n, cpp11::doubles r_size, cpp11::doubles r_prob, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_nbinomial(SEXP ptr, SEXP n, SEXP r_size, SEXP r_prob, SEXP n_threads, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_nbinomial(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_size), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_prob), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_nbinomial(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_size), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_prob), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_hypergeometric(SEXP ptr, int n, cpp11::doubles r_n1, cpp11::doubles r_n2, cpp11::doubles r_k, int n_threads, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_hypergeometric(SEXP ptr, SEXP n, SEXP r_n1, SEXP r_n2, SEXP r_k, SEXP n_threads, SEXP is_float) {
+cpp11::sexp mcstate_rng_nbinomial_mu(SEXP ptr, int n, cpp11::doubles r_size, cpp11::doubles r_mu, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_nbinomial_mu(SEXP ptr, SEXP n, SEXP r_size, SEXP r_mu, SEXP n_threads, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_hypergeometric(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_n1), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_n2), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_k), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_nbinomial_mu(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_size), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_mu), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_gamma(SEXP ptr, int n, cpp11::doubles r_a, cpp11::doubles r_b, int n_threads, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_gamma(SEXP ptr, SEXP n, SEXP r_a, SEXP r_b, SEXP n_threads, SEXP is_float) {
+cpp11::sexp mcstate_rng_hypergeometric(SEXP ptr, int n, cpp11::doubles r_n1, cpp11::doubles r_n2, cpp11::doubles r_k, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_hypergeometric(SEXP ptr, SEXP n, SEXP r_n1, SEXP r_n2, SEXP r_k, SEXP n_threads, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_gamma(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_a), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_b), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_hypergeometric(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_n1), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_n2), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_k), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_poisson(SEXP ptr, int n, cpp11::doubles r_lambda, int n_threads, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_poisson(SEXP ptr, SEXP n, SEXP r_lambda, SEXP n_threads, SEXP is_float) {
+cpp11::sexp mcstate_rng_multivariate_hypergeometric(SEXP ptr, int n, cpp11::doubles r_n, cpp11::doubles r_k, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_multivariate_hypergeometric(SEXP ptr, SEXP n, SEXP r_n, SEXP r_k, SEXP n_threads, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_poisson(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_lambda), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_multivariate_hypergeometric(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_k), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
-cpp11::sexp mcstate_rng_cauchy(SEXP ptr, int n, cpp11::doubles r_location, cpp11::doubles r_scale, int n_threads, bool is_float);
-extern "C" SEXP _mcstate2_mcstate_rng_cauchy(SEXP ptr, SEXP n, SEXP r_location, SEXP r_scale, SEXP n_threads, SEXP is_float) {
+cpp11::sexp mcstate_rng_gamma(SEXP ptr, int n, cpp11::doubles r_a, cpp11::doubles r_b, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_gamma(SEXP ptr, SEXP n, SEXP r_a, SEXP r_b, SEXP n_threads, SEXP split, SEXP is_float) {
   BEGIN_CPP11
-    return cpp11::as_sexp(mcstate_rng_cauchy(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_location), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_scale), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+    return cpp11::as_sexp(mcstate_rng_gamma(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_a), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_b), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// random.cpp
+cpp11::sexp mcstate_rng_poisson(SEXP ptr, int n, cpp11::doubles r_lambda, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_poisson(SEXP ptr, SEXP n, SEXP r_lambda, SEXP n_threads, SEXP split, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_poisson(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_lambda), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// random.cpp
+cpp11::sexp mcstate_rng_cauchy(SEXP ptr, int n, cpp11::doubles r_location, cpp11::doubles r_scale, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_cauchy(SEXP ptr, SEXP n, SEXP r_location, SEXP r_scale, SEXP n_threads, SEXP split, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_cauchy(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_location), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_scale), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
 // random.cpp
@@ -113,12 +162,118 @@ extern "C" SEXP _mcstate2_mcstate_rng_multinomial(SEXP ptr, SEXP n, SEXP r_size,
   END_CPP11
 }
 // random.cpp
+cpp11::sexp mcstate_rng_beta_binomial(SEXP ptr, int n, cpp11::doubles r_size, cpp11::doubles r_prob, cpp11::doubles r_rho, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_beta_binomial(SEXP ptr, SEXP n, SEXP r_size, SEXP r_prob, SEXP r_rho, SEXP n_threads, SEXP split, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_beta_binomial(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_size), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_prob), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_rho), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// random.cpp
+cpp11::sexp mcstate_rng_dirichlet_multinomial(SEXP ptr, int n, cpp11::doubles r_size, cpp11::doubles r_alpha, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_dirichlet_multinomial(SEXP ptr, SEXP n, SEXP r_size, SEXP r_alpha, SEXP n_threads, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_dirichlet_multinomial(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_size), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_alpha), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// random.cpp
+cpp11::sexp mcstate_rng_random_integer(SEXP ptr, int n, cpp11::doubles r_max, int n_threads, bool split, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_random_integer(SEXP ptr, SEXP n, SEXP r_max, SEXP n_threads, SEXP split, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_random_integer(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_max), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(split), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// random.cpp
+cpp11::sexp mcstate_rng_permutation(SEXP ptr, int n, int len, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_permutation(SEXP ptr, SEXP n, SEXP len, SEXP n_threads, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_permutation(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(len), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// random.cpp
+cpp11::sexp mcstate_rng_sample_without_replacement(SEXP ptr, int n, int population, int size, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_sample_without_replacement(SEXP ptr, SEXP n, SEXP population, SEXP size, SEXP n_threads, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_sample_without_replacement(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(population), cpp11::as_cpp<cpp11::decay_t<int>>(size), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// random.cpp
+cpp11::sexp mcstate_rng_poisson_process(SEXP ptr, int n, int n_max, cpp11::doubles r_rate, cpp11::doubles r_t_end, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_poisson_process(SEXP ptr, SEXP n, SEXP n_max, SEXP r_rate, SEXP r_t_end, SEXP n_threads, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_poisson_process(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_max), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_rate), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_t_end), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// random.cpp
+cpp11::sexp mcstate_rng_poisson_process_thinning(SEXP ptr, int n, int n_max, cpp11::doubles r_time, cpp11::doubles r_rate, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_poisson_process_thinning(SEXP ptr, SEXP n, SEXP n_max, SEXP r_time, SEXP r_rate, SEXP n_threads, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_poisson_process_thinning(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_max), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_time), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(r_rate), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// random.cpp
 cpp11::sexp mcstate_rng_state(SEXP ptr, bool is_float);
 extern "C" SEXP _mcstate2_mcstate_rng_state(SEXP ptr, SEXP is_float) {
   BEGIN_CPP11
     return cpp11::as_sexp(mcstate_rng_state(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
   END_CPP11
 }
+// rng_buffer.cpp
+SEXP mcstate_rng_buffer_alloc(SEXP ptr, int buffer, bool async, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_buffer_alloc(SEXP ptr, SEXP buffer, SEXP async, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_buffer_alloc(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(buffer), cpp11::as_cpp<cpp11::decay_t<bool>>(async), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// rng_buffer.cpp
+SEXP mcstate_rng_buffer_random_real(SEXP buf, int n, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_buffer_random_real(SEXP buf, SEXP n, SEXP n_threads, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_buffer_random_real(cpp11::as_cpp<cpp11::decay_t<SEXP>>(buf), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// rng_buffer.cpp
+SEXP mcstate_rng_buffer_random_normal(SEXP buf, int n, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_buffer_random_normal(SEXP buf, SEXP n, SEXP n_threads, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_buffer_random_normal(cpp11::as_cpp<cpp11::decay_t<SEXP>>(buf), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// rng_buffer.cpp
+void mcstate_rng_buffer_flush(SEXP buf, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_buffer_flush(SEXP buf, SEXP is_float) {
+  BEGIN_CPP11
+    mcstate_rng_buffer_flush(cpp11::as_cpp<cpp11::decay_t<SEXP>>(buf), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float));
+    return R_NilValue;
+  END_CPP11
+}
+// rng_buffer.cpp
+cpp11::integers mcstate_rng_buffer_available(SEXP buf, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_buffer_available(SEXP buf, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_buffer_available(cpp11::as_cpp<cpp11::decay_t<SEXP>>(buf), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// rng_buffer.cpp
+SEXP mcstate_rng_buffer_pending(SEXP buf, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_buffer_pending(SEXP buf, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_buffer_pending(cpp11::as_cpp<cpp11::decay_t<SEXP>>(buf), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// rng_lazy.cpp
+SEXP mcstate_rng_lazy_random_real(SEXP ptr, int n, int n_threads, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_lazy_random_real(SEXP ptr, SEXP n, SEXP n_threads, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_lazy_random_real(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// rng_lazy.cpp
+SEXP mcstate_rng_lazy_random_normal(SEXP ptr, int n, int n_threads, std::string algorithm, bool is_float);
+extern "C" SEXP _mcstate2_mcstate_rng_lazy_random_normal(SEXP ptr, SEXP n, SEXP n_threads, SEXP algorithm, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_lazy_random_normal(cpp11::as_cpp<cpp11::decay_t<SEXP>>(ptr), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<std::string>>(algorithm), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
 // rng_pointer.cpp
 cpp11::sexp mcstate_rng_pointer_init(int n_streams, cpp11::sexp seed, int long_jump, std::string algorithm);
 extern "C" SEXP _mcstate2_mcstate_rng_pointer_init(SEXP n_streams, SEXP seed, SEXP long_jump, SEXP algorithm) {
@@ -127,6 +282,13 @@ extern "C" SEXP _mcstate2_mcstate_rng_pointer_init(SEXP n_streams, SEXP seed, SE
   END_CPP11
 }
 // rng_pointer.cpp
+cpp11::sexp mcstate_rng_distributed_state_init(cpp11::sexp seed, int n_streams, int n_nodes, std::string algorithm);
+extern "C" SEXP _mcstate2_mcstate_rng_distributed_state_init(SEXP seed, SEXP n_streams, SEXP n_nodes, SEXP algorithm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(mcstate_rng_distributed_state_init(cpp11::as_cpp<cpp11::decay_t<cpp11::sexp>>(seed), cpp11::as_cpp<cpp11::decay_t<int>>(n_streams), cpp11::as_cpp<cpp11::decay_t<int>>(n_nodes), cpp11::as_cpp<cpp11::decay_t<std::string>>(algorithm)));
+  END_CPP11
+}
+// rng_pointer.cpp
 void mcstate_rng_pointer_sync(cpp11::environment obj, std::string algorithm);
 extern "C" SEXP _mcstate2_mcstate_rng_pointer_sync(SEXP obj, SEXP algorithm) {
   BEGIN_CPP11
@@ -135,12 +297,64 @@ extern "C" SEXP _mcstate2_mcstate_rng_pointer_sync(SEXP obj, SEXP algorithm) {
   END_CPP11
 }
 // rng_pointer.cpp
+void mcstate_rng_pointer_save(cpp11::environment obj, std::string algorithm, std::string filename);
+extern "C" SEXP _mcstate2_mcstate_rng_pointer_save(SEXP obj, SEXP algorithm, SEXP filename) {
+  BEGIN_CPP11
+    mcstate_rng_pointer_save(cpp11::as_cpp<cpp11::decay_t<cpp11::environment>>(obj), cpp11::as_cpp<cpp11::decay_t<std::string>>(algorithm), cpp11::as_cpp<cpp11::decay_t<std::string>>(filename));
+    return R_NilValue;
+  END_CPP11
+}
+// rng_pointer.cpp
+void mcstate_rng_pointer_load(cpp11::environment obj, std::string algorithm, std::string filename);
+extern "C" SEXP _mcstate2_mcstate_rng_pointer_load(SEXP obj, SEXP algorithm, SEXP filename) {
+  BEGIN_CPP11
+    mcstate_rng_pointer_load(cpp11::as_cpp<cpp11::decay_t<cpp11::environment>>(obj), cpp11::as_cpp<cpp11::decay_t<std::string>>(algorithm), cpp11::as_cpp<cpp11::decay_t<std::string>>(filename));
+    return R_NilValue;
+  END_CPP11
+}
+// rng_pointer.cpp
 double test_rng_pointer_get(cpp11::environment obj, int n_streams);
 extern "C" SEXP _mcstate2_test_rng_pointer_get(SEXP obj, SEXP n_streams) {
   BEGIN_CPP11
     return cpp11::as_sexp(test_rng_pointer_get(cpp11::as_cpp<cpp11::decay_t<cpp11::environment>>(obj), cpp11::as_cpp<cpp11::decay_t<int>>(n_streams)));
   END_CPP11
 }
+// test_math.cpp
+std::vector<double> test_math_array(std::string fn, cpp11::doubles x, bool is_float);
+extern "C" SEXP _mcstate2_test_math_array(SEXP fn, SEXP x, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(test_math_array(cpp11::as_cpp<cpp11::decay_t<std::string>>(fn), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(x), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// test_particle.cpp
+SEXP test_walk_filter_alloc(double time_start, cpp11::doubles time, cpp11::list data, int n_particles, int n_threads, cpp11::sexp seed, std::string method);
+extern "C" SEXP _mcstate2_test_walk_filter_alloc(SEXP time_start, SEXP time, SEXP data, SEXP n_particles, SEXP n_threads, SEXP seed, SEXP method) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(test_walk_filter_alloc(cpp11::as_cpp<cpp11::decay_t<double>>(time_start), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(time), cpp11::as_cpp<cpp11::decay_t<cpp11::list>>(data), cpp11::as_cpp<cpp11::decay_t<int>>(n_particles), cpp11::as_cpp<cpp11::decay_t<int>>(n_threads), cpp11::as_cpp<cpp11::decay_t<cpp11::sexp>>(seed), cpp11::as_cpp<cpp11::decay_t<std::string>>(method)));
+  END_CPP11
+}
+// test_particle.cpp
+double test_walk_filter_run(cpp11::sexp ptr, cpp11::doubles pars);
+extern "C" SEXP _mcstate2_test_walk_filter_run(SEXP ptr, SEXP pars) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(test_walk_filter_run(cpp11::as_cpp<cpp11::decay_t<cpp11::sexp>>(ptr), cpp11::as_cpp<cpp11::decay_t<cpp11::doubles>>(pars)));
+  END_CPP11
+}
+// test_particle.cpp
+cpp11::sexp test_walk_filter_rng_state(cpp11::sexp ptr);
+extern "C" SEXP _mcstate2_test_walk_filter_rng_state(SEXP ptr) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(test_walk_filter_rng_state(cpp11::as_cpp<cpp11::decay_t<cpp11::sexp>>(ptr)));
+  END_CPP11
+}
+// test_particle.cpp
+void test_walk_filter_set_rng_state(cpp11::sexp ptr, cpp11::raws state);
+extern "C" SEXP _mcstate2_test_walk_filter_set_rng_state(SEXP ptr, SEXP state) {
+  BEGIN_CPP11
+    test_walk_filter_set_rng_state(cpp11::as_cpp<cpp11::decay_t<cpp11::sexp>>(ptr), cpp11::as_cpp<cpp11::decay_t<cpp11::raws>>(state));
+    return R_NilValue;
+  END_CPP11
+}
 // test_rng.cpp
 std::vector<std::string> test_xoshiro_run(cpp11::environment obj);
 extern "C" SEXP _mcstate2_test_xoshiro_run(SEXP obj) {
@@ -148,35 +362,91 @@ extern "C" SEXP _mcstate2_test_xoshiro_run(SEXP obj) {
     return cpp11::as_sexp(test_xoshiro_run(cpp11::as_cpp<cpp11::decay_t<cpp11::environment>>(obj)));
   END_CPP11
 }
+// test_rng.cpp
+bool test_jump_ahead(std::string algorithm);
+extern "C" SEXP _mcstate2_test_jump_ahead(SEXP algorithm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(test_jump_ahead(cpp11::as_cpp<cpp11::decay_t<std::string>>(algorithm)));
+  END_CPP11
+}
+// test_rng.cpp
+std::vector<double> test_ziggurat(int n_layers, int n, int seed, bool is_float);
+extern "C" SEXP _mcstate2_test_ziggurat(SEXP n_layers, SEXP n, SEXP seed, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(test_ziggurat(cpp11::as_cpp<cpp11::decay_t<int>>(n_layers), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<int>>(seed), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
+// test_rng.cpp
+std::vector<double> test_rejection_scalar(std::string distribution, int n, std::vector<double> a, std::vector<double> b, int n_streams, int seed, bool is_float);
+extern "C" SEXP _mcstate2_test_rejection_scalar(SEXP distribution, SEXP n, SEXP a, SEXP b, SEXP n_streams, SEXP seed, SEXP is_float) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(test_rejection_scalar(cpp11::as_cpp<cpp11::decay_t<std::string>>(distribution), cpp11::as_cpp<cpp11::decay_t<int>>(n), cpp11::as_cpp<cpp11::decay_t<std::vector<double>>>(a), cpp11::as_cpp<cpp11::decay_t<std::vector<double>>>(b), cpp11::as_cpp<cpp11::decay_t<int>>(n_streams), cpp11::as_cpp<cpp11::decay_t<int>>(seed), cpp11::as_cpp<cpp11::decay_t<bool>>(is_float)));
+  END_CPP11
+}
 
 extern "C" {
 static const R_CallMethodDef CallEntries[] = {
-    {"_mcstate2_mcstate_rng_alloc",          (DL_FUNC) &_mcstate2_mcstate_rng_alloc,          4},
-    {"_mcstate2_mcstate_rng_binomial",       (DL_FUNC) &_mcstate2_mcstate_rng_binomial,       6},
-    {"_mcstate2_mcstate_rng_cauchy",         (DL_FUNC) &_mcstate2_mcstate_rng_cauchy,         6},
-    {"_mcstate2_mcstate_rng_exponential",    (DL_FUNC) &_mcstate2_mcstate_rng_exponential,    5},
-    {"_mcstate2_mcstate_rng_gamma",          (DL_FUNC) &_mcstate2_mcstate_rng_gamma,          6},
-    {"_mcstate2_mcstate_rng_hypergeometric", (DL_FUNC) &_mcstate2_mcstate_rng_hypergeometric, 7},
-    {"_mcstate2_mcstate_rng_jump",           (DL_FUNC) &_mcstate2_mcstate_rng_jump,           2},
-    {"_mcstate2_mcstate_rng_long_jump",      (DL_FUNC) &_mcstate2_mcstate_rng_long_jump,      2},
-    {"_mcstate2_mcstate_rng_multinomial",    (DL_FUNC) &_mcstate2_mcstate_rng_multinomial,    6},
-    {"_mcstate2_mcstate_rng_nbinomial",      (DL_FUNC) &_mcstate2_mcstate_rng_nbinomial,      6},
-    {"_mcstate2_mcstate_rng_normal",         (DL_FUNC) &_mcstate2_mcstate_rng_normal,         7},
-    {"_mcstate2_mcstate_rng_pointer_init",   (DL_FUNC) &_mcstate2_mcstate_rng_pointer_init,   4},
-    {"_mcstate2_mcstate_rng_pointer_sync",   (DL_FUNC) &_mcstate2_mcstate_rng_pointer_sync,   2},
-    {"_mcstate2_mcstate_rng_poisson",        (DL_FUNC) &_mcstate2_mcstate_rng_poisson,        5},
-    {"_mcstate2_mcstate_rng_random_normal",  (DL_FUNC) &_mcstate2_mcstate_rng_random_normal,  5},
-    {"_mcstate2_mcstate_rng_random_real",    (DL_FUNC) &_mcstate2_mcstate_rng_random_real,    4},
-    {"_mcstate2_mcstate_rng_state",          (DL_FUNC) &_mcstate2_mcstate_rng_state,          2},
-    {"_mcstate2_mcstate_rng_uniform",        (DL_FUNC) &_mcstate2_mcstate_rng_uniform,        6},
-    {"_mcstate2_test_rng_pointer_get",       (DL_FUNC) &_mcstate2_test_rng_pointer_get,       2},
-    {"_mcstate2_test_xoshiro_run",           (DL_FUNC) &_mcstate2_test_xoshiro_run,           1},
+    {"_mcstate2_mcstate_log_weights_normalise",           (DL_FUNC) &_mcstate2_mcstate_log_weights_normalise,           2},
+    {"_mcstate2_mcstate_log_weights_summary",             (DL_FUNC) &_mcstate2_mcstate_log_weights_summary,             2},
+    {"_mcstate2_mcstate_packer_pack",                     (DL_FUNC) &_mcstate2_mcstate_packer_pack,                     2},
+    {"_mcstate2_mcstate_packer_unpack",                   (DL_FUNC) &_mcstate2_mcstate_packer_unpack,                   3},
+    {"_mcstate2_mcstate_rng_alloc",                       (DL_FUNC) &_mcstate2_mcstate_rng_alloc,                       4},
+    {"_mcstate2_mcstate_rng_beta_binomial",               (DL_FUNC) &_mcstate2_mcstate_rng_beta_binomial,               8},
+    {"_mcstate2_mcstate_rng_binomial",                    (DL_FUNC) &_mcstate2_mcstate_rng_binomial,                    7},
+    {"_mcstate2_mcstate_rng_buffer_alloc",                (DL_FUNC) &_mcstate2_mcstate_rng_buffer_alloc,                4},
+    {"_mcstate2_mcstate_rng_buffer_available",            (DL_FUNC) &_mcstate2_mcstate_rng_buffer_available,            2},
+    {"_mcstate2_mcstate_rng_buffer_flush",                (DL_FUNC) &_mcstate2_mcstate_rng_buffer_flush,                2},
+    {"_mcstate2_mcstate_rng_buffer_pending",              (DL_FUNC) &_mcstate2_mcstate_rng_buffer_pending,              2},
+    {"_mcstate2_mcstate_rng_buffer_random_normal",        (DL_FUNC) &_mcstate2_mcstate_rng_buffer_random_normal,        4},
+    {"_mcstate2_mcstate_rng_buffer_random_real",          (DL_FUNC) &_mcstate2_mcstate_rng_buffer_random_real,          4},
+    {"_mcstate2_mcstate_rng_cauchy",                      (DL_FUNC) &_mcstate2_mcstate_rng_cauchy,                      7},
+    {"_mcstate2_mcstate_rng_dirichlet_multinomial",       (DL_FUNC) &_mcstate2_mcstate_rng_dirichlet_multinomial,       6},
+    {"_mcstate2_mcstate_rng_distributed_state_init",      (DL_FUNC) &_mcstate2_mcstate_rng_distributed_state_init,      4},
+    {"_mcstate2_mcstate_rng_exponential",                 (DL_FUNC) &_mcstate2_mcstate_rng_exponential,                 6},
+    {"_mcstate2_mcstate_rng_gamma",                       (DL_FUNC) &_mcstate2_mcstate_rng_gamma,                       7},
+    {"_mcstate2_mcstate_rng_hypergeometric",              (DL_FUNC) &_mcstate2_mcstate_rng_hypergeometric,              8},
+    {"_mcstate2_mcstate_rng_jump",                        (DL_FUNC) &_mcstate2_mcstate_rng_jump,                        2},
+    {"_mcstate2_mcstate_rng_lazy_random_normal",          (DL_FUNC) &_mcstate2_mcstate_rng_lazy_random_normal,          5},
+    {"_mcstate2_mcstate_rng_lazy_random_real",            (DL_FUNC) &_mcstate2_mcstate_rng_lazy_random_real,            4},
+    {"_mcstate2_mcstate_rng_long_jump",                   (DL_FUNC) &_mcstate2_mcstate_rng_long_jump,                   2},
+    {"_mcstate2_mcstate_rng_multinomial",                 (DL_FUNC) &_mcstate2_mcstate_rng_multinomial,                 6},
+    {"_mcstate2_mcstate_rng_multivariate_hypergeometric", (DL_FUNC) &_mcstate2_mcstate_rng_multivariate_hypergeometric, 6},
+    {"_mcstate2_mcstate_rng_nbinomial",                   (DL_FUNC) &_mcstate2_mcstate_rng_nbinomial,                   7},
+    {"_mcstate2_mcstate_rng_nbinomial_mu",                (DL_FUNC) &_mcstate2_mcstate_rng_nbinomial_mu,                7},
+    {"_mcstate2_mcstate_rng_normal",                      (DL_FUNC) &_mcstate2_mcstate_rng_normal,                      8},
+    {"_mcstate2_mcstate_rng_permutation",                 (DL_FUNC) &_mcstate2_mcstate_rng_permutation,                 5},
+    {"_mcstate2_mcstate_rng_pointer_init",                (DL_FUNC) &_mcstate2_mcstate_rng_pointer_init,                4},
+    {"_mcstate2_mcstate_rng_pointer_load",                (DL_FUNC) &_mcstate2_mcstate_rng_pointer_load,                3},
+    {"_mcstate2_mcstate_rng_pointer_save",                (DL_FUNC) &_mcstate2_mcstate_rng_pointer_save,                3},
+    {"_mcstate2_mcstate_rng_pointer_sync",                (DL_FUNC) &_mcstate2_mcstate_rng_pointer_sync,                2},
+    {"_mcstate2_mcstate_rng_poisson",                     (DL_FUNC) &_mcstate2_mcstate_rng_poisson,                     6},
+    {"_mcstate2_mcstate_rng_poisson_process",             (DL_FUNC) &_mcstate2_mcstate_rng_poisson_process,             7},
+    {"_mcstate2_mcstate_rng_poisson_process_thinning",    (DL_FUNC) &_mcstate2_mcstate_rng_poisson_process_thinning,    7},
+    {"_mcstate2_mcstate_rng_random_integer",              (DL_FUNC) &_mcstate2_mcstate_rng_random_integer,              6},
+    {"_mcstate2_mcstate_rng_random_normal",               (DL_FUNC) &_mcstate2_mcstate_rng_random_normal,               6},
+    {"_mcstate2_mcstate_rng_random_real",                 (DL_FUNC) &_mcstate2_mcstate_rng_random_real,                 5},
+    {"_mcstate2_mcstate_rng_resample",                    (DL_FUNC) &_mcstate2_mcstate_rng_resample,                    5},
+    {"_mcstate2_mcstate_rng_sample_without_replacement",  (DL_FUNC) &_mcstate2_mcstate_rng_sample_without_replacement,  6},
+    {"_mcstate2_mcstate_rng_state",                       (DL_FUNC) &_mcstate2_mcstate_rng_state,                       2},
+    {"_mcstate2_mcstate_rng_uniform",                     (DL_FUNC) &_mcstate2_mcstate_rng_uniform,                     7},
+    {"_mcstate2_test_jump_ahead",                         (DL_FUNC) &_mcstate2_test_jump_ahead,                         1},
+    {"_mcstate2_test_math_array",                         (DL_FUNC) &_mcstate2_test_math_array,                         3},
+    {"_mcstate2_test_rejection_scalar",                   (DL_FUNC) &_mcstate2_test_rejection_scalar,                   7},
+    {"_mcstate2_test_rng_pointer_get",                    (DL_FUNC) &_mcstate2_test_rng_pointer_get,                    2},
+    {"_mcstate2_test_walk_filter_alloc",                  (DL_FUNC) &_mcstate2_test_walk_filter_alloc,                  7},
+    {"_mcstate2_test_walk_filter_rng_state",              (DL_FUNC) &_mcstate2_test_walk_filter_rng_state,              1},
+    {"_mcstate2_test_walk_filter_run",                    (DL_FUNC) &_mcstate2_test_walk_filter_run,                    2},
+    {"_mcstate2_test_walk_filter_set_rng_state",          (DL_FUNC) &_mcstate2_test_walk_filter_set_rng_state,          2},
+    {"_mcstate2_test_xoshiro_run",                        (DL_FUNC) &_mcstate2_test_xoshiro_run,                        1},
+    {"_mcstate2_test_ziggurat",                           (DL_FUNC) &_mcstate2_test_ziggurat,                           4},
     {NULL, NULL, 0}
 };
 }
 
+void mcstate_rng_lazy_init(DllInfo* dll);
 extern "C" attribute_visible void R_init_mcstate2(DllInfo* dll){
   R_registerRoutines(dll, NULL, CallEntries, NULL, NULL);
   R_useDynamicSymbols(dll, FALSE);
+  mcstate_rng_lazy_init(dll);
   R_forceSymbols(dll, TRUE);
 }
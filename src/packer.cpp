@@ -0,0 +1,73 @@
+#include <cstring>
+
+#include <cpp11/doubles.hpp>
+#include <cpp11/integers.hpp>
+#include <cpp11/list.hpp>
+#include <cpp11/strings.hpp>
+
+// Unpack a parameter vector into a named list in a single pass. If
+// 'prev' is a previous result from this function (with the same
+// layout) then any entry whose values have not changed is reused
+// rather than reallocated, which is the common case within MCMC where
+// only a subset of parameters move at each step.
+[[cpp11::register]]
+SEXP mcstate_packer_unpack(cpp11::list layout, cpp11::doubles x,
+                           cpp11::sexp prev) {
+  const cpp11::strings names = layout["names"];
+  const cpp11::integers offset = layout["offset"];
+  const cpp11::integers length = layout["length"];
+  const cpp11::list shape = layout["shape"];
+  const R_xlen_t n = names.size();
+  const bool reuse = prev != R_NilValue;
+  const double * data = REAL(x);
+
+  cpp11::writable::list ret(n);
+  for (R_xlen_t i = 0; i < n; ++i) {
+    const double * src = data + offset[i];
+    const size_t len = length[i];
+    if (reuse) {
+      SEXP el = VECTOR_ELT(prev, i);
+      if (std::memcmp(REAL(el), src, len * sizeof(double)) == 0) {
+        SET_VECTOR_ELT(ret, i, el);
+        continue;
+      }
+    }
+    cpp11::writable::doubles el(len);
+    std::memcpy(REAL(el), src, len * sizeof(double));
+    const cpp11::integers shape_i = shape[i];
+    if (shape_i.size() > 1) {
+      el.attr("dim") = shape_i;
+    }
+    SET_VECTOR_ELT(ret, i, el);
+  }
+  ret.names() = names;
+  return ret;
+}
+
+// Pack a list of parameters (already subset to the packed entries, in
+// order, and with lengths checked) into a single vector.
+[[cpp11::register]]
+cpp11::writable::doubles mcstate_packer_pack(cpp11::list p, int len) {
+  cpp11::writable::doubles ret(len);
+  double * dest = REAL(ret);
+  for (R_xlen_t i = 0; i < p.size(); ++i) {
+    SEXP el = p[i];
+    const R_xlen_t n = Rf_xlength(el);
+    switch (TYPEOF(el)) {
+    case REALSXP:
+      std::memcpy(dest, REAL(el), n * sizeof(double));
+      break;
+    case INTSXP:
+    case LGLSXP:
+      for (R_xlen_t j = 0; j < n; ++j) {
+        const int value = INTEGER(el)[j];
+        dest[j] = value == NA_INTEGER ? NA_REAL : value;
+      }
+      break;
+    default:
+      cpp11::stop("Invalid structure to 'pack()'");
+    }
+    dest += n;
+  }
+  return ret;
+}
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cpp11/doubles.hpp>
+#include <cpp11/external_pointer.hpp>
+#include <cpp11/integers.hpp>
+#include <cpp11/list.hpp>
+#include <cpp11/strings.hpp>
+
+#include <mcstate/particle/resample.hpp>
+#include <mcstate/particle/weights.hpp>
+#include <mcstate/r/filter.hpp>
+#include <mcstate/random/random.hpp>
+#include <mcstate/utils.hpp>
+
+// The generator types here match those in random.cpp
+using default_rng64 = mcstate::random::prng<mcstate::random::generator<double>>;
+using default_rng32 = mcstate::random::prng<mcstate::random::generator<float>>;
+
+template <typename real_type, typename T>
+cpp11::sexp mcstate_rng_resample(SEXP ptr, cpp11::doubles r_log_weights,
+                                 std::string method, int n_threads) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+  const auto m = mcstate::r::as_resample_method(method);
+
+  int n_particles;
+  bool vary = false;
+  if (Rf_isMatrix(r_log_weights)) {
+    if (Rf_ncols(r_log_weights) != n_streams) {
+      cpp11::stop("If 'log_weights' is a matrix, it must have %d columns",
+                  n_streams);
+    }
+    n_particles = Rf_nrows(r_log_weights);
+    vary = true;
+  } else {
+    n_particles = r_log_weights.size();
+  }
+  const double * log_weights = REAL(r_log_weights);
+
+  cpp11::writable::integers index(n_particles * n_streams);
+  cpp11::writable::doubles ess(n_streams);
+  int * index_data = INTEGER(index);
+  double * ess_data = REAL(ess);
+
+  mcstate::utils::openmp_errors errors(n_streams);
+  auto resample_stream = [&](int i, int n_threads_stream) {
+    try {
+      mcstate::particle::resampler<real_type> resample(n_threads_stream);
+      auto log_weights_i = log_weights + (vary ? n_particles * i : 0);
+      auto index_i = index_data + n_particles * i;
+      const auto summary = resample(rng->state(i), log_weights_i,
+                                    n_particles, m, index_i);
+      for (int j = 0; j < n_particles; ++j) {
+        ++index_i[j];
+      }
+      ess_data[i] = summary.ess();
+    } catch (std::exception const& e) {
+      errors.capture(e, i);
+    }
+  };
+
+  // With a single stream, use the threads within the resampling
+  // itself (including summarising the weights); this must happen
+  // outside of any parallel region, as nested regions get a single
+  // thread. Otherwise parallelise over streams.
+  if (n_streams == 1) {
+    resample_stream(0, n_threads);
+  } else {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+    for (int i = 0; i < n_streams; ++i) {
+      resample_stream(i, 1);
+    }
+  }
+
+  errors.report("generators", 4, true);
+
+  if (n_streams > 1) {
+    index.attr("dim") = cpp11::writable::integers{n_particles, n_streams};
+  }
+  using namespace cpp11::literals;
+  return cpp11::writable::list({"index"_nm = index, "ess"_nm = ess});
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_resample(SEXP ptr, cpp11::doubles r_log_weights,
+                                 std::string method, int n_threads,
+                                 bool is_float) {
+  return is_float ?
+    mcstate_rng_resample<float, default_rng32>(ptr, r_log_weights, method, n_threads) :
+    mcstate_rng_resample<double, default_rng64>(ptr, r_log_weights, method, n_threads);
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_log_weights_summary(cpp11::doubles w, int n_threads) {
+  const auto summary =
+    mcstate::particle::summarise_log_weights<double>(REAL(w), w.size(),
+                                                     n_threads);
+  using namespace cpp11::literals;
+  return cpp11::writable::doubles({"log_sum"_nm = summary.log_sum(),
+                                   "ess"_nm = summary.ess()});
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_log_weights_normalise(cpp11::doubles w, int n_threads) {
+  cpp11::writable::doubles ret(w.size());
+  double * data = REAL(ret);
+  std::copy(w.begin(), w.end(), data);
+  mcstate::particle::normalise_log_weights<double>(data, w.size(), n_threads);
+  return ret;
+}
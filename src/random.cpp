@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <climits>
+#include <cmath>
 #include <cstring>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -10,6 +14,7 @@
 #include <cpp11/raws.hpp>
 
 #include <mcstate/r/random.hpp>
+#include <mcstate/random/jump_ahead.hpp>
 #include <mcstate/random/random.hpp>
 #include <mcstate/utils.hpp>
 
@@ -44,21 +49,116 @@ cpp11::sexp sexp_matrix(cpp11::sexp x, int n, int m) {
   return x;
 }
 
+// Draws from each stream are normally made serially, so we can only
+// parallelise over streams. If 'split' is true and more than
+// 'split_block_size' draws are requested, the draws from each stream
+// are instead divided into blocks of this size, each drawn from its
+// own substream (see mcstate::random::substream_jump): block b starts
+// from the stream's state jumped forward by b substreams, and the
+// stream is left at the start of the first unused substream. The
+// blocks can then be drawn in parallel, and the result depends on the
+// number of streams and draws but not on the number of threads. The
+// first block matches the draws made without splitting. The
+// distributions do not change the state of a deterministic stream,
+// so there every block uses the stream's own state and the stream is
+// not moved on; the raw uniform, normal and integer draws ignore the
+// deterministic flag, and pass 'honour_deterministic' as false.
+constexpr size_t split_block_size = 65536;
+
+template <typename T>
+class draw_blocks {
+public:
+  using rng_state = typename T::rng_state;
+
+  draw_blocks(T *rng, int n, bool split, bool honour_deterministic = true) :
+    rng_(rng), n_(n),
+    n_blocks_(split && n_ > split_block_size ?
+              (n_ + split_block_size - 1) / split_block_size : 1) {
+    if (n_blocks_ > 1) {
+      const size_t n_streams = rng_->size();
+      state_.reserve(n_streams * n_blocks_);
+      for (size_t i = 0; i < n_streams; ++i) {
+        auto s = rng_->state(i);
+        if (honour_deterministic && s.deterministic) {
+          state_.insert(state_.end(), n_blocks_, s);
+          continue;
+        }
+        for (size_t b = 0; b < n_blocks_; ++b) {
+          state_.push_back(s);
+          mcstate::random::substream_jump(s);
+        }
+        rng_->state(i) = s;
+      }
+    }
+  }
+
+  size_t size() const {
+    return rng_->size() * n_blocks_;
+  }
+
+  int stream(size_t b) const {
+    return b / n_blocks_;
+  }
+
+  size_t from(size_t b) const {
+    return (b % n_blocks_) * split_block_size;
+  }
+
+  size_t to(size_t b) const {
+    return n_blocks_ == 1 ? n_ : std::min(from(b) + split_block_size, n_);
+  }
+
+  rng_state& state(size_t b) {
+    return n_blocks_ == 1 ? rng_->state(b) : state_[b];
+  }
+
+private:
+  T *rng_;
+  size_t n_;
+  size_t n_blocks_;
+  std::vector<rng_state> state_;
+};
+
+// Most loops below use static scheduling, as every stream (or block)
+// does the same amount of work. For the discrete distributions and
+// the gamma, the algorithm (and so the cost of a draw) depends on the
+// parameters: a binomial with small 'n * p' uses inversion while a
+// large one uses BTRS, and the Poisson switches from Knuth's method
+// to Hormann's at lambda = 10. Where the parameters vary over
+// streams, static scheduling can leave threads idle while one works
+// through the expensive streams, so these loops hand out work
+// dynamically instead. Handing out one stream at a time costs a
+// dispatch per stream, which dominates when there are many streams
+// each making a few cheap draws, so streams are handed out in chunks
+// sized to give each thread about 16 of them (one stream at a time
+// when there are few streams); inst/random/schedule times the
+// alternatives. Each stream draws from its own state, so the schedule
+// has no effect on the result.
+inline int dynamic_chunk_size(size_t n_work, int n_threads) {
+  constexpr size_t chunks_per_thread = 16;
+  return std::max<size_t>(
+    1, n_work / (chunks_per_thread * std::max(n_threads, 1)));
+}
+
 template <typename real_type, typename T>
-cpp11::sexp mcstate_rng_random_real(SEXP ptr, int n, int n_threads) {
+cpp11::sexp mcstate_rng_random_real(SEXP ptr, int n, int n_threads,
+                                    bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
 
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
   double * y = REAL(ret);
 
+  draw_blocks<T> blocks(rng, n, split, false);
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
-    auto &state = rng->state(i);
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
+    auto &state = blocks.state(b);
     auto y_i = y + n * i;
-    for (size_t j = 0; j < (size_t)n; ++j) {
+    for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
       y_i[j] = mcstate::random::random_real<real_type>(state);
     }
   }
@@ -67,20 +167,24 @@ cpp11::sexp mcstate_rng_random_real(SEXP ptr, int n, int n_threads) {
 }
 
 template <typename real_type, mcstate::random::algorithm::normal A, typename T>
-cpp11::sexp mcstate_rng_random_normal(SEXP ptr, int n, int n_threads) {
+cpp11::sexp mcstate_rng_random_normal(SEXP ptr, int n, int n_threads,
+                                      bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
 
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
   double * y = REAL(ret);
 
+  draw_blocks<T> blocks(rng, n, split, false);
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
-    auto &state = rng->state(i);
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
+    auto &state = blocks.state(b);
     auto y_i = y + n * i;
-    for (size_t j = 0; j < (size_t)n; ++j) {
+    for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
       y_i[j] = mcstate::random::random_normal<real_type, A>(state);
     }
   }
@@ -88,6 +192,33 @@ cpp11::sexp mcstate_rng_random_normal(SEXP ptr, int n, int n_threads) {
   return sexp_matrix(ret, n, n_streams);
 }
 
+// Bulk Box-Muller, using both draws from each transform; this gives
+// a different sequence to the "box_muller" algorithm
+template <typename real_type, typename T>
+cpp11::sexp mcstate_rng_random_normal_pair(SEXP ptr, int n, int n_threads,
+                                           bool split) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+
+  cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
+  double * y = REAL(ret);
+
+  draw_blocks<T> blocks(rng, n, split, false);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
+    auto &state = blocks.state(b);
+    const size_t from = blocks.from(b);
+    mcstate::random::random_normal_box_muller_fill<real_type>(
+      state, y + n * i + from, blocks.to(b) - from);
+  }
+
+  return sexp_matrix(ret, n, n_streams);
+}
+
 struct input_vary {
   size_t len;
   size_t offset;
@@ -178,7 +309,7 @@ template <typename real_type, typename T>
 cpp11::sexp mcstate_rng_uniform(SEXP ptr, int n,
                              cpp11::doubles r_min,
                              cpp11::doubles r_max,
-                             int n_threads) {
+                             int n_threads, bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
@@ -189,15 +320,18 @@ cpp11::sexp mcstate_rng_uniform(SEXP ptr, int n,
   auto min_vary = check_input_type(r_min, n, n_streams, "min");
   auto max_vary = check_input_type(r_max, n, n_streams, "max");
 
+  draw_blocks<T> blocks(rng, n, split);
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
-    auto &state = rng->state(i);
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
+    auto &state = blocks.state(b);
     auto y_i = y + n * i;
     auto min_i = min_vary.generator ? min + min_vary.offset * i : min;
     auto max_i = max_vary.generator ? max + max_vary.offset * i : max;
-    for (size_t j = 0; j < (size_t)n; ++j) {
+    for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
       auto min_ij = min_vary.draw ? min_i[j] : min_i[0];
       auto max_ij = max_vary.draw ? max_i[j] : max_i[0];
       y_i[j] = mcstate::random::uniform<real_type>(state, min_ij, max_ij);
@@ -209,7 +343,7 @@ cpp11::sexp mcstate_rng_uniform(SEXP ptr, int n,
 
 template <typename real_type, typename T>
 cpp11::sexp mcstate_rng_exponential(SEXP ptr, int n, cpp11::doubles r_rate,
-                                 int n_threads) {
+                                 int n_threads, bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
@@ -218,14 +352,17 @@ cpp11::sexp mcstate_rng_exponential(SEXP ptr, int n, cpp11::doubles r_rate,
   const double * rate = REAL(r_rate);
   auto rate_vary = check_input_type(r_rate, n, n_streams, "rate");
 
+  draw_blocks<T> blocks(rng, n, split);
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
-    auto &state = rng->state(i);
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
+    auto &state = blocks.state(b);
     auto y_i = y + n * i;
     auto rate_i = rate_vary.generator ? rate + rate_vary.offset * i : rate;
-    for (size_t j = 0; j < (size_t)n; ++j) {
+    for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
       auto rate_ij = rate_vary.draw ? rate_i[j] : rate_i[0];
       y_i[j] = mcstate::random::exponential<real_type>(state, rate_ij);
     }
@@ -238,7 +375,7 @@ cpp11::sexp mcstate_rng_exponential(SEXP ptr, int n, cpp11::doubles r_rate,
 template <typename real_type, mcstate::random::algorithm::normal A, typename T>
 cpp11::sexp mcstate_rng_normal(SEXP ptr, int n,
                             cpp11::doubles r_mean, cpp11::doubles r_sd,
-                            int n_threads) {
+                            int n_threads, bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
@@ -249,15 +386,18 @@ cpp11::sexp mcstate_rng_normal(SEXP ptr, int n,
   auto mean_vary = check_input_type(r_mean, n, n_streams, "mean");
   auto sd_vary = check_input_type(r_sd, n, n_streams, "sd");
 
+  draw_blocks<T> blocks(rng, n, split);
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
-    auto &state = rng->state(i);
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
+    auto &state = blocks.state(b);
     auto y_i = y + n * i;
     auto mean_i = mean_vary.generator ? mean + mean_vary.offset * i : mean;
     auto sd_i = sd_vary.generator ? sd + sd_vary.offset * i : sd;
-    for (size_t j = 0; j < (size_t)n; ++j) {
+    for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
       auto mean_ij = mean_vary.draw ? mean_i[j] : mean_i[0];
       auto sd_ij = sd_vary.draw ? sd_i[j] : sd_i[0];
       y_i[j] = mcstate::random::normal<real_type, A>(state, mean_ij, sd_ij);
@@ -267,10 +407,132 @@ cpp11::sexp mcstate_rng_normal(SEXP ptr, int n,
   return sexp_matrix(ret, n, n_streams);
 }
 
+template <typename real_type, typename T>
+cpp11::sexp mcstate_rng_normal_pair(SEXP ptr, int n,
+                                 cpp11::doubles r_mean, cpp11::doubles r_sd,
+                                 int n_threads, bool split) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+  cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
+  double * y = REAL(ret);
+
+  const double * mean = REAL(r_mean);
+  const double * sd = REAL(r_sd);
+  auto mean_vary = check_input_type(r_mean, n, n_streams, "mean");
+  auto sd_vary = check_input_type(r_sd, n, n_streams, "sd");
+
+  draw_blocks<T> blocks(rng, n, split);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
+    auto &state = blocks.state(b);
+    auto y_i = y + n * i;
+    auto mean_i = mean_vary.generator ? mean + mean_vary.offset * i : mean;
+    auto sd_i = sd_vary.generator ? sd + sd_vary.offset * i : sd;
+    const size_t from = blocks.from(b), to = blocks.to(b);
+    if (state.deterministic) {
+      std::fill(y_i + from, y_i + to, 0);
+    } else {
+      mcstate::random::random_normal_box_muller_fill<real_type>(
+        state, y_i + from, to - from);
+    }
+    for (size_t j = from; j < to; ++j) {
+      const real_type mean_ij = mean_vary.draw ? mean_i[j] : mean_i[0];
+      const real_type sd_ij = sd_vary.draw ? sd_i[j] : sd_i[0];
+      y_i[j] = static_cast<real_type>(y_i[j]) * sd_ij + mean_ij;
+    }
+  }
+
+  return sexp_matrix(ret, n, n_streams);
+}
+
+// Where their parameters are fixed over draws (though they may vary
+// over streams), the binomial and Poisson samplers run their
+// rejection algorithms for several streams (or blocks) in lockstep,
+// so that the fast path is vectorised (see
+// mcstate::random::rejection_lanes); where the parameters change from
+// draw to draw, the per-lane bookkeeping costs more than this saves,
+// and the draws are made one block at a time as usual. Each thread
+// takes a group of up to lane_width blocks at a time, but groups are
+// kept small enough to give every thread some work. Each lane draws
+// from its own state exactly as it would alone, so neither the
+// grouping nor the schedule affects the result.
+template <typename real_type>
+size_t lane_group_size(size_t n_blocks, int n_threads) {
+  const size_t per_thread = n_blocks / std::max(n_threads, 1);
+  return std::max<size_t>(
+    1, std::min(mcstate::random::lane_width<real_type>(), per_thread));
+}
+
+// Presents the blocks [from, from + n_lanes) to the lane samplers;
+// 'a' is the size (binomial) or lambda (Poisson) and 'b' the prob
+template <typename real_type, typename T>
+class lane_draws {
+public:
+  lane_draws(draw_blocks<T>& blocks, size_t from, int n, double * y,
+             const double * a, input_vary a_vary,
+             const double * b, input_vary b_vary,
+             mcstate::utils::openmp_errors& errors) :
+    blocks_(blocks), from_(from), n_(n), y_(y),
+    a_(a), a_vary_(a_vary), b_(b), b_vary_(b_vary), errors_(errors) {
+  }
+
+  size_t len(size_t l) const {
+    return blocks_.to(from_ + l) - blocks_.from(from_ + l);
+  }
+
+  real_type size(size_t l, size_t j) const {
+    return param(a_, a_vary_, l, j);
+  }
+
+  real_type prob(size_t l, size_t j) const {
+    return param(b_, b_vary_, l, j);
+  }
+
+  real_type lambda(size_t l, size_t j) const {
+    return param(a_, a_vary_, l, j);
+  }
+
+  void set(size_t l, size_t j, real_type x) {
+    const size_t b = from_ + l;
+    y_[n_ * blocks_.stream(b) + blocks_.from(b) + j] = x;
+  }
+
+  void error(size_t l, const std::exception& e) {
+    // Several blocks may share a stream
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+    errors_.capture(e, blocks_.stream(from_ + l));
+  }
+
+private:
+  draw_blocks<T>& blocks_;
+  size_t from_;
+  size_t n_;
+  double * y_;
+  const double * a_;
+  input_vary a_vary_;
+  const double * b_;
+  input_vary b_vary_;
+  mcstate::utils::openmp_errors& errors_;
+
+  real_type param(const double * x, const input_vary& vary,
+                  size_t l, size_t j) const {
+    const size_t b = from_ + l;
+    const double * x_i = vary.generator ?
+      x + vary.offset * blocks_.stream(b) : x;
+    return vary.draw ? x_i[blocks_.from(b) + j] : x_i[0];
+  }
+};
+
 template <typename real_type, typename T>
 cpp11::sexp mcstate_rng_binomial(SEXP ptr, int n,
                               cpp11::doubles r_size, cpp11::doubles r_prob,
-                              int n_threads) {
+                              int n_threads, bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
@@ -283,22 +545,50 @@ cpp11::sexp mcstate_rng_binomial(SEXP ptr, int n,
 
   mcstate::utils::openmp_errors errors(n_streams);
 
+  draw_blocks<T> blocks(rng, n, split);
+
+  if (!size_vary.draw && !prob_vary.draw) {
+    const size_t group = lane_group_size<real_type>(blocks.size(), n_threads);
+    const size_t n_groups = (blocks.size() + group - 1) / group;
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) num_threads(n_threads)
+    const int chunk = dynamic_chunk_size(n_groups, n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
-    try {
-      auto &state = rng->state(i);
-      auto y_i = y + n * i;
-      auto size_i = size_vary.generator ? size + size_vary.offset * i : size;
-      auto prob_i = prob_vary.generator ? prob + prob_vary.offset * i : prob;
-      for (size_t j = 0; j < (size_t)n; ++j) {
-        auto size_ij = size_vary.draw ? size_i[j] : size_i[0];
-        auto prob_ij = prob_vary.draw ? prob_i[j] : prob_i[0];
-        y_i[j] = mcstate::random::binomial<real_type>(state, size_ij, prob_ij);
+    for (size_t g = 0; g < n_groups; ++g) {
+      const size_t from = g * group;
+      const size_t n_lanes = std::min(group, blocks.size() - from);
+      typename T::rng_state * state[mcstate::random::lane_width<real_type>()];
+      for (size_t l = 0; l < n_lanes; ++l) {
+        state[l] = &blocks.state(from + l);
+      }
+      lane_draws<real_type, T> draws(blocks, from, n, y, size, size_vary,
+                                     prob, prob_vary, errors);
+      mcstate::random::binomial_lanes<real_type>(state, n_lanes, draws);
+    }
+  } else {
+#ifdef _OPENMP
+    const int chunk = dynamic_chunk_size(blocks.size(), n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
+#endif
+    for (size_t b = 0; b < blocks.size(); ++b) {
+      const int i = blocks.stream(b);
+      try {
+        auto &state = blocks.state(b);
+        auto y_i = y + n * i;
+        auto size_i = size_vary.generator ? size + size_vary.offset * i : size;
+        auto prob_i = prob_vary.generator ? prob + prob_vary.offset * i : prob;
+        for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
+          auto size_ij = size_vary.draw ? size_i[j] : size_i[0];
+          auto prob_ij = prob_vary.draw ? prob_i[j] : prob_i[0];
+          y_i[j] = mcstate::random::binomial<real_type>(state, size_ij, prob_ij);
+        }
+      } catch (std::exception const& e) {
+        // Several blocks may share a stream
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        errors.capture(e, i);
       }
-    } catch (std::exception const& e) {
-      errors.capture(e, i);
     }
   }
 
@@ -308,10 +598,12 @@ cpp11::sexp mcstate_rng_binomial(SEXP ptr, int n,
 }
 
 
-template <typename real_type, typename T>
+// The negative binomial can be parameterised with either 'prob' or
+// 'mu' as its second parameter (see use_mu)
+template <typename real_type, typename T, bool use_mu>
 cpp11::sexp mcstate_rng_nbinomial(SEXP ptr, int n,
                               cpp11::doubles r_size, cpp11::doubles r_prob,
-                              int n_threads) {
+                              int n_threads, bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
@@ -320,25 +612,36 @@ cpp11::sexp mcstate_rng_nbinomial(SEXP ptr, int n,
   const double * size = REAL(r_size);
   const double * prob = REAL(r_prob);
   auto size_vary = check_input_type(r_size, n, n_streams, "size");
-  auto prob_vary = check_input_type(r_prob, n, n_streams, "prob");
+  auto prob_vary = check_input_type(r_prob, n, n_streams,
+                                    use_mu ? "mu" : "prob");
 
   mcstate::utils::openmp_errors errors(n_streams);
 
+  draw_blocks<T> blocks(rng, n, split);
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) num_threads(n_threads)
+  const int chunk = dynamic_chunk_size(blocks.size(), n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
     try {
-      auto &state = rng->state(i);
+      auto &state = blocks.state(b);
       auto y_i = y + n * i;
       auto size_i = size_vary.generator ? size + size_vary.offset * i : size;
       auto prob_i = prob_vary.generator ? prob + prob_vary.offset * i : prob;
-      for (size_t j = 0; j < (size_t)n; ++j) {
+      for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
         auto size_ij = size_vary.draw ? size_i[j] : size_i[0];
         auto prob_ij = prob_vary.draw ? prob_i[j] : prob_i[0];
-        y_i[j] = mcstate::random::nbinomial<real_type>(state, size_ij, prob_ij);
+        y_i[j] = use_mu ?
+          mcstate::random::nbinomial_mu<real_type>(state, size_ij, prob_ij) :
+          mcstate::random::nbinomial<real_type>(state, size_ij, prob_ij);
       }
     } catch (std::exception const& e) {
+      // Several blocks may share a stream
+#ifdef _OPENMP
+#pragma omp critical
+#endif
       errors.capture(e, i);
     }
   }
@@ -350,7 +653,7 @@ cpp11::sexp mcstate_rng_nbinomial(SEXP ptr, int n,
 
 template <typename real_type, typename T>
 cpp11::sexp mcstate_rng_poisson(SEXP ptr, int n, cpp11::doubles r_lambda,
-                             int n_threads) {
+                             int n_threads, bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
@@ -361,21 +664,49 @@ cpp11::sexp mcstate_rng_poisson(SEXP ptr, int n, cpp11::doubles r_lambda,
 
   mcstate::utils::openmp_errors errors(n_streams);
 
+  draw_blocks<T> blocks(rng, n, split);
+
+  if (!lambda_vary.draw) {
+    const size_t group = lane_group_size<real_type>(blocks.size(), n_threads);
+    const size_t n_groups = (blocks.size() + group - 1) / group;
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) num_threads(n_threads)
+    const int chunk = dynamic_chunk_size(n_groups, n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
-    try {
-      auto &state = rng->state(i);
-      auto y_i = y + n * i;
-      auto lambda_i = lambda_vary.generator ? lambda + lambda_vary.offset * i :
-        lambda;
-      for (size_t j = 0; j < (size_t)n; ++j) {
-        auto lambda_ij = lambda_vary.draw ? lambda_i[j] : lambda_i[0];
-        y_i[j] = mcstate::random::poisson<real_type>(state, lambda_ij);
+    for (size_t g = 0; g < n_groups; ++g) {
+      const size_t from = g * group;
+      const size_t n_lanes = std::min(group, blocks.size() - from);
+      typename T::rng_state * state[mcstate::random::lane_width<real_type>()];
+      for (size_t l = 0; l < n_lanes; ++l) {
+        state[l] = &blocks.state(from + l);
+      }
+      lane_draws<real_type, T> draws(blocks, from, n, y, lambda, lambda_vary,
+                                     nullptr, lambda_vary, errors);
+      mcstate::random::poisson_lanes<real_type>(state, n_lanes, draws);
+    }
+  } else {
+#ifdef _OPENMP
+    const int chunk = dynamic_chunk_size(blocks.size(), n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
+#endif
+    for (size_t b = 0; b < blocks.size(); ++b) {
+      const int i = blocks.stream(b);
+      try {
+        auto &state = blocks.state(b);
+        auto y_i = y + n * i;
+        auto lambda_i = lambda_vary.generator ?
+          lambda + lambda_vary.offset * i : lambda;
+        for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
+          auto lambda_ij = lambda_vary.draw ? lambda_i[j] : lambda_i[0];
+          y_i[j] = mcstate::random::poisson<real_type>(state, lambda_ij);
+        }
+      } catch (std::exception const& e) {
+        // Several blocks may share a stream
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        errors.capture(e, i);
       }
-    } catch (std::exception const& e) {
-      errors.capture(e, i);
     }
   }
 
@@ -409,7 +740,8 @@ cpp11::sexp mcstate_rng_multinomial(SEXP ptr, int n,
   mcstate::utils::openmp_errors errors(n_streams);
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) num_threads(n_threads)
+  const int chunk = dynamic_chunk_size(n_streams, n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
 #endif
   for (int i = 0; i < n_streams; ++i) {
     try {
@@ -438,10 +770,187 @@ cpp11::sexp mcstate_rng_multinomial(SEXP ptr, int n,
   return ret;
 }
 
+template <typename real_type, typename T>
+cpp11::sexp mcstate_rng_beta_binomial(SEXP ptr, int n,
+                                   cpp11::doubles r_size, cpp11::doubles r_prob,
+                                   cpp11::doubles r_rho, int n_threads,
+                                   bool split) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+  cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
+  double * y = REAL(ret);
+
+  const double * size = REAL(r_size);
+  const double * prob = REAL(r_prob);
+  const double * rho = REAL(r_rho);
+  auto size_vary = check_input_type(r_size, n, n_streams, "size");
+  auto prob_vary = check_input_type(r_prob, n, n_streams, "prob");
+  auto rho_vary = check_input_type(r_rho, n, n_streams, "rho");
+
+  mcstate::utils::openmp_errors errors(n_streams);
+
+  draw_blocks<T> blocks(rng, n, split);
+
+#ifdef _OPENMP
+  const int chunk = dynamic_chunk_size(blocks.size(), n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
+#endif
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
+    try {
+      auto &state = blocks.state(b);
+      auto y_i = y + n * i;
+      auto size_i = size_vary.generator ? size + size_vary.offset * i : size;
+      auto prob_i = prob_vary.generator ? prob + prob_vary.offset * i : prob;
+      auto rho_i = rho_vary.generator ? rho + rho_vary.offset * i : rho;
+      if (!size_vary.draw && !prob_vary.draw && !rho_vary.draw &&
+          !state.deterministic) {
+        // Parameters are fixed over draws so set up the sampler once
+        const mcstate::random::beta_binomial_sampler<real_type>
+          sampler(size_i[0], prob_i[0], rho_i[0]);
+        sampler(state, y_i + blocks.from(b), blocks.to(b) - blocks.from(b));
+        continue;
+      }
+      for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
+        auto size_ij = size_vary.draw ? size_i[j] : size_i[0];
+        auto prob_ij = prob_vary.draw ? prob_i[j] : prob_i[0];
+        auto rho_ij = rho_vary.draw ? rho_i[j] : rho_i[0];
+        y_i[j] = mcstate::random::beta_binomial<real_type>(state, size_ij,
+                                                            prob_ij, rho_ij);
+      }
+    } catch (std::exception const& e) {
+      // Several blocks may share a stream
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+      errors.capture(e, i);
+    }
+  }
+
+  errors.report("generators", 4, true);
+
+  return sexp_matrix(ret, n, n_streams);
+}
+
+template <typename real_type, typename T>
+cpp11::sexp mcstate_rng_dirichlet_multinomial(SEXP ptr, int n,
+                                           cpp11::doubles r_size,
+                                           cpp11::doubles r_alpha,
+                                           int n_threads) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+
+  const double * size = REAL(r_size);
+  const double * alpha = REAL(r_alpha);
+  auto size_vary = check_input_type(r_size, n, n_streams, "size");
+  auto alpha_vary = check_input_type2(r_alpha, n, n_streams, "alpha");
+  const int len = alpha_vary.len;
+
+  // Same layout as for the multinomial
+  cpp11::writable::doubles ret =
+    cpp11::writable::doubles(len * n * n_streams);
+  double * y = REAL(ret);
+
+  mcstate::utils::openmp_errors errors(n_streams);
+
+#ifdef _OPENMP
+  const int chunk = dynamic_chunk_size(n_streams, n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
+#endif
+  for (int i = 0; i < n_streams; ++i) {
+    try {
+      auto &state = rng->state(i);
+      auto y_i = y + len * n * i;
+      auto size_i = size_vary.generator ? size + size_vary.offset * i : size;
+      auto alpha_i = alpha_vary.generator ? alpha + alpha_vary.offset * i : alpha;
+      for (size_t j = 0; j < (size_t)n; ++j) {
+        auto size_ij = size_vary.draw ? size_i[j] : size_i[0];
+        auto alpha_ij = alpha_vary.draw ? alpha_i + j * len : alpha_i;
+        auto y_ij = y_i + j * len;
+        mcstate::random::dirichlet_multinomial<real_type>(state, size_ij,
+                                                          alpha_ij, len, y_ij);
+      }
+    } catch (std::exception const& e) {
+      errors.capture(e, i);
+    }
+  }
+  errors.report("generators", 4, true);
+
+  if (n_streams == 1) {
+    ret.attr("dim") = cpp11::writable::integers{len, n};
+  } else {
+    ret.attr("dim") = cpp11::writable::integers{len, n, n_streams};
+  }
+  return ret;
+}
+
+template <typename real_type, typename T>
+cpp11::sexp mcstate_rng_multivariate_hypergeometric(SEXP ptr, int n,
+                                                 cpp11::doubles r_n,
+                                                 cpp11::doubles r_k,
+                                                 int n_threads) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+
+  const double * n_col = REAL(r_n);
+  const double * k = REAL(r_k);
+  auto n_vary = check_input_type2(r_n, n, n_streams, "n_colour");
+  auto k_vary = check_input_type(r_k, n, n_streams, "k");
+  const int len = n_vary.len;
+
+  // Same layout as for the multinomial
+  cpp11::writable::doubles ret =
+    cpp11::writable::doubles(len * n * n_streams);
+  double * y = REAL(ret);
+
+  mcstate::utils::openmp_errors errors(n_streams);
+
+#ifdef _OPENMP
+  const int chunk = dynamic_chunk_size(n_streams, n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
+#endif
+  for (int i = 0; i < n_streams; ++i) {
+    try {
+      auto &state = rng->state(i);
+      auto y_i = y + len * n * i;
+      auto n_i = n_vary.generator ? n_col + n_vary.offset * i : n_col;
+      auto k_i = k_vary.generator ? k + k_vary.offset * i : k;
+      // The order only depends on the colour counts, so where these
+      // are fixed over draws we only sort them once.
+      std::vector<int> order(len);
+      if (!n_vary.draw) {
+        mcstate::random::multivariate_hypergeometric_order(n_i, len, order);
+      }
+      for (size_t j = 0; j < (size_t)n; ++j) {
+        auto k_ij = k_vary.draw ? k_i[j] : k_i[0];
+        auto n_ij = n_vary.draw ? n_i + j * len : n_i;
+        auto y_ij = y_i + j * len;
+        if (n_vary.draw) {
+          mcstate::random::multivariate_hypergeometric_order(n_ij, len, order);
+        }
+        mcstate::random::multivariate_hypergeometric<real_type>(state, k_ij,
+                                                             n_ij, len,
+                                                             order, y_ij);
+      }
+    } catch (std::exception const& e) {
+      errors.capture(e, i);
+    }
+  }
+  errors.report("generators", 4, true);
+
+  if (n_streams == 1) {
+    ret.attr("dim") = cpp11::writable::integers{len, n};
+  } else {
+    ret.attr("dim") = cpp11::writable::integers{len, n, n_streams};
+  }
+  return ret;
+}
+
 template <typename real_type, typename T>
 cpp11::sexp mcstate_rng_hypergeometric(SEXP ptr, int n,
                                     cpp11::doubles r_n1, cpp11::doubles r_n2,
-                                    cpp11::doubles r_k, int n_threads) {
+                                    cpp11::doubles r_k, int n_threads,
+                                    bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
@@ -456,23 +965,39 @@ cpp11::sexp mcstate_rng_hypergeometric(SEXP ptr, int n,
 
   mcstate::utils::openmp_errors errors(n_streams);
 
+  draw_blocks<T> blocks(rng, n, split);
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) num_threads(n_threads)
+  const int chunk = dynamic_chunk_size(blocks.size(), n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
     try {
-      auto &state = rng->state(i);
+      auto &state = blocks.state(b);
       auto y_i = y + n * i;
       auto n1_i = n1_vary.generator ? n1 + n1_vary.offset * i : n1;
       auto n2_i = n2_vary.generator ? n2 + n2_vary.offset * i : n2;
       auto k_i = k_vary.generator ? k + k_vary.offset * i : k;
-      for (size_t j = 0; j < (size_t)n; ++j) {
+      if (!n1_vary.draw && !n2_vary.draw && !k_vary.draw &&
+          !state.deterministic) {
+        // Parameters are fixed over draws so set up the sampler once
+        const mcstate::random::hypergeometric_sampler<real_type>
+          sampler(n1_i[0], n2_i[0], k_i[0]);
+        sampler(state, y_i + blocks.from(b), blocks.to(b) - blocks.from(b));
+        continue;
+      }
+      for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
         auto n1_ij = n1_vary.draw ? n1_i[j] : n1_i[0];
         auto n2_ij = n2_vary.draw ? n2_i[j] : n2_i[0];
         auto k_ij = k_vary.draw ? k_i[j] : k_i[0];
         y_i[j] = mcstate::random::hypergeometric<real_type>(state, n1_ij, n2_ij, k_ij);
       }
     } catch (std::exception const& e) {
+      // Several blocks may share a stream
+#ifdef _OPENMP
+#pragma omp critical
+#endif
       errors.capture(e, i);
     }
   }
@@ -485,7 +1010,8 @@ cpp11::sexp mcstate_rng_hypergeometric(SEXP ptr, int n,
 
 template <typename real_type, typename T>
 cpp11::sexp mcstate_rng_gamma(SEXP ptr, int n,
-                           cpp11::doubles r_shape, cpp11::doubles r_scale, int n_threads) {
+                           cpp11::doubles r_shape, cpp11::doubles r_scale, int n_threads,
+                           bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
@@ -498,21 +1024,29 @@ cpp11::sexp mcstate_rng_gamma(SEXP ptr, int n,
 
   mcstate::utils::openmp_errors errors(n_streams);
 
+  draw_blocks<T> blocks(rng, n, split);
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) num_threads(n_threads)
+  const int chunk = dynamic_chunk_size(blocks.size(), n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
     try {
-      auto &state = rng->state(i);
+      auto &state = blocks.state(b);
       auto y_i = y + n * i;
       auto shape_i = shape_vary.generator ? shape + shape_vary.offset * i : shape;
       auto scale_i = scale_vary.generator ? scale + scale_vary.offset * i : scale;
-      for (size_t j = 0; j < (size_t)n; ++j) {
+      for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
         auto shape_ij = shape_vary.draw ? shape_i[j] : shape_i[0];
         auto scale_ij = scale_vary.draw ? scale_i[j] : scale_i[0];
         y_i[j] = mcstate::random::gamma<real_type>(state, shape_ij, scale_ij);
       }
     } catch (std::exception const& e) {
+      // Several blocks may share a stream
+#ifdef _OPENMP
+#pragma omp critical
+#endif
       errors.capture(e, i);
     }
   }
@@ -530,7 +1064,7 @@ template <typename real_type, typename T>
 cpp11::sexp mcstate_rng_cauchy(SEXP ptr, int n,
                             cpp11::doubles r_location,
                             cpp11::doubles r_scale,
-                            int n_threads) {
+                            int n_threads, bool split) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
   const int n_streams = rng->size();
   cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
@@ -543,21 +1077,28 @@ cpp11::sexp mcstate_rng_cauchy(SEXP ptr, int n,
 
   mcstate::utils::openmp_errors errors(n_streams);
 
+  draw_blocks<T> blocks(rng, n, split);
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static) num_threads(n_threads)
 #endif
-  for (int i = 0; i < n_streams; ++i) {
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
     try {
-      auto &state = rng->state(i);
+      auto &state = blocks.state(b);
       auto y_i = y + n * i;
       auto location_i = location_vary.generator ? location + location_vary.offset * i : location;
       auto scale_i = scale_vary.generator ? scale + scale_vary.offset * i : scale;
-      for (size_t j = 0; j < (size_t)n; ++j) {
+      for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
         auto location_ij = location_vary.draw ? location_i[j] : location_i[0];
         auto scale_ij = scale_vary.draw ? scale_i[j] : scale_i[0];
         y_i[j] = mcstate::random::cauchy<real_type>(state, location_ij, scale_ij);
       }
     } catch (std::exception const& e) {
+      // Several blocks may share a stream
+#ifdef _OPENMP
+#pragma omp critical
+#endif
       errors.capture(e, i);
     }
   }
@@ -567,6 +1108,212 @@ cpp11::sexp mcstate_rng_cauchy(SEXP ptr, int n,
   return sexp_matrix(ret, n, n_streams);
 }
 
+// The integer draws below return 1-based R integers, and do not
+// depend on the real type.
+template <typename T>
+cpp11::sexp mcstate_rng_random_integer(SEXP ptr, int n, cpp11::doubles r_max,
+                                    int n_threads, bool split) {
+  using int_type = typename T::rng_state::int_type;
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+  cpp11::writable::integers ret = cpp11::writable::integers(n * n_streams);
+  int * y = INTEGER(ret);
+
+  const double * max = REAL(r_max);
+  auto max_vary = check_input_type(r_max, n, n_streams, "max");
+
+  mcstate::utils::openmp_errors errors(n_streams);
+
+  draw_blocks<T> blocks(rng, n, split, false);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const int i = blocks.stream(b);
+    try {
+      auto &state = blocks.state(b);
+      auto y_i = y + n * i;
+      auto max_i = max_vary.generator ? max + max_vary.offset * i : max;
+      for (size_t j = blocks.from(b); j < blocks.to(b); ++j) {
+        auto max_ij = max_vary.draw ? max_i[j] : max_i[0];
+        if (!(max_ij >= 1 && max_ij <= INT_MAX) ||
+            max_ij != std::floor(max_ij)) {
+          char buffer[256];
+          snprintf(buffer, 256,
+                   "Invalid call to random_integer with max = %g", max_ij);
+          mcstate::utils::fatal_error(buffer);
+        }
+        y_i[j] = 1 + mcstate::random::random_integer(state,
+                                                     static_cast<int_type>(max_ij));
+      }
+    } catch (std::exception const& e) {
+      // Several blocks may share a stream
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+      errors.capture(e, i);
+    }
+  }
+
+  errors.report("generators", 4, true);
+
+  return sexp_matrix(ret, n, n_streams);
+}
+
+// Used for both permutations (len == size) and samples without
+// replacement; the layout of the result is the same as for the
+// multinomial.
+template <typename T>
+cpp11::sexp mcstate_rng_sample(SEXP ptr, int n, int len, int size,
+                               bool permutation, int n_threads) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+  cpp11::writable::integers ret =
+    cpp11::writable::integers(size * n * n_streams);
+  int * y = INTEGER(ret);
+  const bool uses_work = !permutation &&
+    mcstate::random::sample_without_replacement_uses_work(len, size);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (int i = 0; i < n_streams; ++i) {
+    auto &state = rng->state(i);
+    std::vector<int> work(uses_work ? len : 0);
+    for (size_t j = 0; j < (size_t)n; ++j) {
+      auto y_ij = y + size * (n * i + j);
+      if (permutation) {
+        mcstate::random::permutation(state, len, y_ij);
+      } else {
+        mcstate::random::sample_without_replacement(state, len, size, y_ij,
+                                                    work);
+      }
+      for (int k = 0; k < size; ++k) {
+        ++y_ij[k];
+      }
+    }
+  }
+
+  if (n_streams == 1) {
+    ret.attr("dim") = cpp11::writable::integers{size, n};
+  } else {
+    ret.attr("dim") = cpp11::writable::integers{size, n, n_streams};
+  }
+  return ret;
+}
+
+// Each realisation of a Poisson process is written into its own
+// slot of 'n_max' values, padded with NA after the last event; the
+// layout of the result is the same as for the multinomial.
+template <typename real_type, typename T>
+cpp11::sexp mcstate_rng_poisson_process(SEXP ptr, int n, int n_max,
+                                        cpp11::doubles r_rate,
+                                        cpp11::doubles r_t_end,
+                                        int n_threads) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+  cpp11::writable::doubles ret =
+    cpp11::writable::doubles(n_max * n * n_streams);
+  double * y = REAL(ret);
+
+  const double * rate = REAL(r_rate);
+  const double * t_end = REAL(r_t_end);
+  auto rate_vary = check_input_type(r_rate, n, n_streams, "rate");
+  auto t_end_vary = check_input_type(r_t_end, n, n_streams, "t_end");
+
+  mcstate::utils::openmp_errors errors(n_streams);
+
+#ifdef _OPENMP
+  const int chunk = dynamic_chunk_size(n_streams, n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
+#endif
+  for (int i = 0; i < n_streams; ++i) {
+    try {
+      auto &state = rng->state(i);
+      auto y_i = y + n_max * n * i;
+      auto rate_i = rate_vary.generator ? rate + rate_vary.offset * i : rate;
+      auto t_end_i =
+        t_end_vary.generator ? t_end + t_end_vary.offset * i : t_end;
+      for (size_t j = 0; j < (size_t)n; ++j) {
+        auto rate_ij = rate_vary.draw ? rate_i[j] : rate_i[0];
+        auto t_end_ij = t_end_vary.draw ? t_end_i[j] : t_end_i[0];
+        auto y_ij = y_i + j * n_max;
+        const int len =
+          mcstate::random::poisson_process<real_type>(state, rate_ij, 0,
+                                                      t_end_ij, n_max, y_ij);
+        std::fill(y_ij + len, y_ij + n_max, NA_REAL);
+      }
+    } catch (std::exception const& e) {
+      errors.capture(e, i);
+    }
+  }
+  errors.report("generators", 4, true);
+
+  if (n_streams == 1) {
+    ret.attr("dim") = cpp11::writable::integers{n_max, n};
+  } else {
+    ret.attr("dim") = cpp11::writable::integers{n_max, n, n_streams};
+  }
+  return ret;
+}
+
+// As above, but with the rate given as a table over 'time'; 'rate'
+// follows the same conventions as the multinomial 'prob'.
+template <typename real_type, typename T>
+cpp11::sexp mcstate_rng_poisson_process_thinning(SEXP ptr, int n, int n_max,
+                                                 cpp11::doubles r_time,
+                                                 cpp11::doubles r_rate,
+                                                 int n_threads) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+
+  const double * time = REAL(r_time);
+  const double * rate = REAL(r_rate);
+  auto rate_vary = check_input_type2(r_rate, n, n_streams, "rate");
+  const int len = rate_vary.len;
+  if (r_time.size() != len) {
+    cpp11::stop("Expected 'time' to have length %d, to match 'rate'", len);
+  }
+
+  cpp11::writable::doubles ret =
+    cpp11::writable::doubles(n_max * n * n_streams);
+  double * y = REAL(ret);
+
+  mcstate::utils::openmp_errors errors(n_streams);
+
+#ifdef _OPENMP
+  const int chunk = dynamic_chunk_size(n_streams, n_threads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(n_threads)
+#endif
+  for (int i = 0; i < n_streams; ++i) {
+    try {
+      auto &state = rng->state(i);
+      auto y_i = y + n_max * n * i;
+      auto rate_i = rate_vary.generator ? rate + rate_vary.offset * i : rate;
+      for (size_t j = 0; j < (size_t)n; ++j) {
+        auto rate_ij = rate_vary.draw ? rate_i + j * len : rate_i;
+        auto y_ij = y_i + j * n_max;
+        const int n_events =
+          mcstate::random::poisson_process_thinning<real_type>(state, time,
+                                                               rate_ij, len,
+                                                               n_max, y_ij);
+        std::fill(y_ij + n_events, y_ij + n_max, NA_REAL);
+      }
+    } catch (std::exception const& e) {
+      errors.capture(e, i);
+    }
+  }
+  errors.report("generators", 4, true);
+
+  if (n_streams == 1) {
+    ret.attr("dim") = cpp11::writable::integers{n_max, n};
+  } else {
+    ret.attr("dim") = cpp11::writable::integers{n_max, n, n_streams};
+  }
+  return ret;
+}
+
 template <typename T>
 cpp11::sexp mcstate_rng_state(SEXP ptr) {
   T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
@@ -605,31 +1352,36 @@ void mcstate_rng_long_jump(SEXP ptr, bool is_float) {
 
 [[cpp11::register]]
 cpp11::sexp mcstate_rng_random_real(SEXP ptr, int n, int n_threads,
-                                 bool is_float) {
+                                 bool split, bool is_float) {
   return is_float ?
-    mcstate_rng_random_real<float, default_rng32>(ptr, n, n_threads) :
-    mcstate_rng_random_real<double, default_rng64>(ptr, n, n_threads);
+    mcstate_rng_random_real<float, default_rng32>(ptr, n, n_threads, split) :
+    mcstate_rng_random_real<double, default_rng64>(ptr, n, n_threads, split);
 }
 
 [[cpp11::register]]
 cpp11::sexp mcstate_rng_random_normal(SEXP ptr, int n, int n_threads,
-                                   std::string algorithm, bool is_float) {
+                                   std::string algorithm, bool split,
+                                   bool is_float) {
   cpp11::sexp ret;
   if (algorithm == "box_muller") {
     constexpr auto a = mcstate::random::algorithm::normal::box_muller;
     ret = is_float ?
-      mcstate_rng_random_normal<float, a, default_rng32>(ptr, n, n_threads) :
-      mcstate_rng_random_normal<double, a, default_rng64>(ptr, n, n_threads);
+      mcstate_rng_random_normal<float, a, default_rng32>(ptr, n, n_threads, split) :
+      mcstate_rng_random_normal<double, a, default_rng64>(ptr, n, n_threads, split);
   } else if (algorithm == "polar") {
     constexpr auto a = mcstate::random::algorithm::normal::polar;
     ret = is_float ?
-      mcstate_rng_random_normal<float, a, default_rng32>(ptr, n, n_threads) :
-      mcstate_rng_random_normal<double, a, default_rng64>(ptr, n, n_threads);
+      mcstate_rng_random_normal<float, a, default_rng32>(ptr, n, n_threads, split) :
+      mcstate_rng_random_normal<double, a, default_rng64>(ptr, n, n_threads, split);
   } else if (algorithm == "ziggurat") {
     constexpr auto a = mcstate::random::algorithm::normal::ziggurat;
     ret = is_float ?
-      mcstate_rng_random_normal<float, a, default_rng32>(ptr, n, n_threads) :
-      mcstate_rng_random_normal<double, a, default_rng64>(ptr, n, n_threads);
+      mcstate_rng_random_normal<float, a, default_rng32>(ptr, n, n_threads, split) :
+      mcstate_rng_random_normal<double, a, default_rng64>(ptr, n, n_threads, split);
+  } else if (algorithm == "box_muller_pair") {
+    ret = is_float ?
+      mcstate_rng_random_normal_pair<float, default_rng32>(ptr, n, n_threads, split) :
+      mcstate_rng_random_normal_pair<double, default_rng64>(ptr, n, n_threads, split);
   } else {
     cpp11::stop("Unknown normal algorithm '%s'", algorithm.c_str());
   }
@@ -641,41 +1393,46 @@ cpp11::sexp mcstate_rng_uniform(SEXP ptr, int n,
                              cpp11::doubles r_min,
                              cpp11::doubles r_max,
                              int n_threads,
-                             bool is_float) {
+                             bool split, bool is_float) {
   return is_float ?
-    mcstate_rng_uniform<float, default_rng32>(ptr, n, r_min, r_max, n_threads) :
-    mcstate_rng_uniform<double, default_rng64>(ptr, n, r_min, r_max, n_threads);
+    mcstate_rng_uniform<float, default_rng32>(ptr, n, r_min, r_max, n_threads, split) :
+    mcstate_rng_uniform<double, default_rng64>(ptr, n, r_min, r_max, n_threads, split);
 }
 
 [[cpp11::register]]
 cpp11::sexp mcstate_rng_exponential(SEXP ptr, int n, cpp11::doubles r_rate,
                                  int n_threads,
-                                 bool is_float) {
+                                 bool split, bool is_float) {
   return is_float ?
-    mcstate_rng_exponential<float, default_rng32>(ptr, n, r_rate, n_threads) :
-    mcstate_rng_exponential<double, default_rng64>(ptr, n, r_rate, n_threads);
+    mcstate_rng_exponential<float, default_rng32>(ptr, n, r_rate, n_threads, split) :
+    mcstate_rng_exponential<double, default_rng64>(ptr, n, r_rate, n_threads, split);
 }
 
 [[cpp11::register]]
 cpp11::sexp mcstate_rng_normal(SEXP ptr, int n, cpp11::doubles r_mean,
                             cpp11::doubles r_sd, int n_threads,
-                            std::string algorithm, bool is_float) {
+                            std::string algorithm, bool split,
+                            bool is_float) {
   cpp11::sexp ret;
   if (algorithm == "box_muller") {
     constexpr auto a = mcstate::random::algorithm::normal::box_muller;
     ret = is_float ?
-      mcstate_rng_normal<float, a, default_rng32>(ptr, n, r_mean, r_sd, n_threads) :
-      mcstate_rng_normal<double, a, default_rng64>(ptr, n, r_mean, r_sd, n_threads);
+      mcstate_rng_normal<float, a, default_rng32>(ptr, n, r_mean, r_sd, n_threads, split) :
+      mcstate_rng_normal<double, a, default_rng64>(ptr, n, r_mean, r_sd, n_threads, split);
   } else if (algorithm == "polar") {
     constexpr auto a = mcstate::random::algorithm::normal::polar;
     ret = is_float ?
-      mcstate_rng_normal<float, a, default_rng32>(ptr, n, r_mean, r_sd, n_threads) :
-      mcstate_rng_normal<double, a, default_rng64>(ptr, n, r_mean, r_sd, n_threads);
+      mcstate_rng_normal<float, a, default_rng32>(ptr, n, r_mean, r_sd, n_threads, split) :
+      mcstate_rng_normal<double, a, default_rng64>(ptr, n, r_mean, r_sd, n_threads, split);
   } else if (algorithm == "ziggurat") {
     constexpr auto a = mcstate::random::algorithm::normal::ziggurat;
     ret = is_float ?
-      mcstate_rng_normal<float, a, default_rng32>(ptr, n, r_mean, r_sd, n_threads) :
-      mcstate_rng_normal<double, a, default_rng64>(ptr, n, r_mean, r_sd, n_threads);
+      mcstate_rng_normal<float, a, default_rng32>(ptr, n, r_mean, r_sd, n_threads, split) :
+      mcstate_rng_normal<double, a, default_rng64>(ptr, n, r_mean, r_sd, n_threads, split);
+  } else if (algorithm == "box_muller_pair") {
+    ret = is_float ?
+      mcstate_rng_normal_pair<float, default_rng32>(ptr, n, r_mean, r_sd, n_threads, split) :
+      mcstate_rng_normal_pair<double, default_rng64>(ptr, n, r_mean, r_sd, n_threads, split);
   } else {
     cpp11::stop("Unknown normal algorithm '%s'", algorithm.c_str());
   }
@@ -685,19 +1442,28 @@ cpp11::sexp mcstate_rng_normal(SEXP ptr, int n, cpp11::doubles r_mean,
 [[cpp11::register]]
 cpp11::sexp mcstate_rng_binomial(SEXP ptr, int n,
                               cpp11::doubles r_size, cpp11::doubles r_prob,
-                              int n_threads, bool is_float) {
+                              int n_threads, bool split, bool is_float) {
   return is_float ?
-    mcstate_rng_binomial<float, default_rng32>(ptr, n, r_size, r_prob, n_threads) :
-    mcstate_rng_binomial<double, default_rng64>(ptr, n, r_size, r_prob, n_threads);
+    mcstate_rng_binomial<float, default_rng32>(ptr, n, r_size, r_prob, n_threads, split) :
+    mcstate_rng_binomial<double, default_rng64>(ptr, n, r_size, r_prob, n_threads, split);
 }
 
 [[cpp11::register]]
 cpp11::sexp mcstate_rng_nbinomial(SEXP ptr, int n,
                               cpp11::doubles r_size, cpp11::doubles r_prob,
-                              int n_threads, bool is_float) {
+                              int n_threads, bool split, bool is_float) {
+  return is_float ?
+    mcstate_rng_nbinomial<float, default_rng32, false>(ptr, n, r_size, r_prob, n_threads, split) :
+    mcstate_rng_nbinomial<double, default_rng64, false>(ptr, n, r_size, r_prob, n_threads, split);
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_nbinomial_mu(SEXP ptr, int n,
+                                 cpp11::doubles r_size, cpp11::doubles r_mu,
+                                 int n_threads, bool split, bool is_float) {
   return is_float ?
-    mcstate_rng_nbinomial<float, default_rng32>(ptr, n, r_size, r_prob, n_threads) :
-    mcstate_rng_nbinomial<double, default_rng64>(ptr, n, r_size, r_prob, n_threads);
+    mcstate_rng_nbinomial<float, default_rng32, true>(ptr, n, r_size, r_mu, n_threads, split) :
+    mcstate_rng_nbinomial<double, default_rng64, true>(ptr, n, r_size, r_mu, n_threads, split);
 }
 
 [[cpp11::register]]
@@ -705,29 +1471,40 @@ cpp11::sexp mcstate_rng_hypergeometric(SEXP ptr, int n,
                                     cpp11::doubles r_n1,
                                     cpp11::doubles r_n2,
                                     cpp11::doubles r_k,
-                                    int n_threads, bool is_float) {
+                                    int n_threads, bool split, bool is_float) {
   return is_float ?
-    mcstate_rng_hypergeometric<float, default_rng32>(ptr, n, r_n1, r_n2, r_k, n_threads) :
-    mcstate_rng_hypergeometric<double, default_rng64>(ptr, n, r_n1, r_n2, r_k, n_threads);
+    mcstate_rng_hypergeometric<float, default_rng32>(ptr, n, r_n1, r_n2, r_k, n_threads, split) :
+    mcstate_rng_hypergeometric<double, default_rng64>(ptr, n, r_n1, r_n2, r_k, n_threads, split);
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_multivariate_hypergeometric(SEXP ptr, int n,
+                                                 cpp11::doubles r_n,
+                                                 cpp11::doubles r_k,
+                                                 int n_threads,
+                                                 bool is_float) {
+  return is_float ?
+    mcstate_rng_multivariate_hypergeometric<float, default_rng32>(ptr, n, r_n, r_k, n_threads) :
+    mcstate_rng_multivariate_hypergeometric<double, default_rng64>(ptr, n, r_n, r_k, n_threads);
 }
 
 [[cpp11::register]]
 cpp11::sexp mcstate_rng_gamma(SEXP ptr, int n,
                            cpp11::doubles r_a, cpp11::doubles r_b,
-                           int n_threads, bool is_float) {
+                           int n_threads, bool split, bool is_float) {
   return is_float ?
-    mcstate_rng_gamma<float, default_rng32>(ptr, n, r_a, r_b, n_threads) :
-    mcstate_rng_gamma<double, default_rng64>(ptr, n, r_a, r_b, n_threads);
+    mcstate_rng_gamma<float, default_rng32>(ptr, n, r_a, r_b, n_threads, split) :
+    mcstate_rng_gamma<double, default_rng64>(ptr, n, r_a, r_b, n_threads, split);
 }
 
 
 [[cpp11::register]]
 cpp11::sexp mcstate_rng_poisson(SEXP ptr, int n,
                              cpp11::doubles r_lambda,
-                             int n_threads, bool is_float) {
+                             int n_threads, bool split, bool is_float) {
   return is_float ?
-    mcstate_rng_poisson<float, default_rng32>(ptr, n, r_lambda, n_threads) :
-    mcstate_rng_poisson<double, default_rng64>(ptr, n, r_lambda, n_threads);
+    mcstate_rng_poisson<float, default_rng32>(ptr, n, r_lambda, n_threads, split) :
+    mcstate_rng_poisson<double, default_rng64>(ptr, n, r_lambda, n_threads, split);
 }
 
 [[cpp11::register]]
@@ -735,10 +1512,10 @@ cpp11::sexp mcstate_rng_cauchy(SEXP ptr, int n,
                             cpp11::doubles r_location,
                             cpp11::doubles r_scale,
                             int n_threads,
-                            bool is_float) {
+                            bool split, bool is_float) {
   return is_float ?
-    mcstate_rng_cauchy<float, default_rng32>(ptr, n, r_location, r_scale, n_threads) :
-    mcstate_rng_cauchy<double, default_rng64>(ptr, n, r_location, r_scale, n_threads);
+    mcstate_rng_cauchy<float, default_rng32>(ptr, n, r_location, r_scale, n_threads, split) :
+    mcstate_rng_cauchy<double, default_rng64>(ptr, n, r_location, r_scale, n_threads, split);
 }
 
 [[cpp11::register]]
@@ -750,6 +1527,90 @@ cpp11::sexp mcstate_rng_multinomial(SEXP ptr, int n,
     mcstate_rng_multinomial<double, default_rng64>(ptr, n, r_size, r_prob, n_threads);
 }
 
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_beta_binomial(SEXP ptr, int n,
+                                   cpp11::doubles r_size,
+                                   cpp11::doubles r_prob,
+                                   cpp11::doubles r_rho,
+                                   int n_threads, bool split, bool is_float) {
+  return is_float ?
+    mcstate_rng_beta_binomial<float, default_rng32>(ptr, n, r_size, r_prob, r_rho, n_threads, split) :
+    mcstate_rng_beta_binomial<double, default_rng64>(ptr, n, r_size, r_prob, r_rho, n_threads, split);
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_dirichlet_multinomial(SEXP ptr, int n,
+                                           cpp11::doubles r_size,
+                                           cpp11::doubles r_alpha,
+                                           int n_threads, bool is_float) {
+  return is_float ?
+    mcstate_rng_dirichlet_multinomial<float, default_rng32>(ptr, n, r_size, r_alpha, n_threads) :
+    mcstate_rng_dirichlet_multinomial<double, default_rng64>(ptr, n, r_size, r_alpha, n_threads);
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_random_integer(SEXP ptr, int n, cpp11::doubles r_max,
+                                    int n_threads, bool split, bool is_float) {
+  return is_float ?
+    mcstate_rng_random_integer<default_rng32>(ptr, n, r_max, n_threads, split) :
+    mcstate_rng_random_integer<default_rng64>(ptr, n, r_max, n_threads, split);
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_permutation(SEXP ptr, int n, int len, int n_threads,
+                                 bool is_float) {
+  if (len < 0) {
+    cpp11::stop("'len' must be non-negative");
+  }
+  return is_float ?
+    mcstate_rng_sample<default_rng32>(ptr, n, len, len, true, n_threads) :
+    mcstate_rng_sample<default_rng64>(ptr, n, len, len, true, n_threads);
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_sample_without_replacement(SEXP ptr, int n,
+                                                int population, int size,
+                                                int n_threads,
+                                                bool is_float) {
+  if (population < 0) {
+    cpp11::stop("'population' must be non-negative");
+  }
+  if (size < 0 || size > population) {
+    cpp11::stop("'size' must be between 0 and 'population' (%d)",
+                population);
+  }
+  return is_float ?
+    mcstate_rng_sample<default_rng32>(ptr, n, population, size, false, n_threads) :
+    mcstate_rng_sample<default_rng64>(ptr, n, population, size, false, n_threads);
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_poisson_process(SEXP ptr, int n, int n_max,
+                                        cpp11::doubles r_rate,
+                                        cpp11::doubles r_t_end,
+                                        int n_threads, bool is_float) {
+  if (n_max < 0) {
+    cpp11::stop("'n_max' must be non-negative");
+  }
+  return is_float ?
+    mcstate_rng_poisson_process<float, default_rng32>(ptr, n, n_max, r_rate, r_t_end, n_threads) :
+    mcstate_rng_poisson_process<double, default_rng64>(ptr, n, n_max, r_rate, r_t_end, n_threads);
+}
+
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_poisson_process_thinning(SEXP ptr, int n, int n_max,
+                                                 cpp11::doubles r_time,
+                                                 cpp11::doubles r_rate,
+                                                 int n_threads,
+                                                 bool is_float) {
+  if (n_max < 0) {
+    cpp11::stop("'n_max' must be non-negative");
+  }
+  return is_float ?
+    mcstate_rng_poisson_process_thinning<float, default_rng32>(ptr, n, n_max, r_time, r_rate, n_threads) :
+    mcstate_rng_poisson_process_thinning<double, default_rng64>(ptr, n, n_max, r_time, r_rate, n_threads);
+}
+
 [[cpp11::register]]
 cpp11::sexp mcstate_rng_state(SEXP ptr, bool is_float) {
   return is_float ?
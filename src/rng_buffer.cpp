@@ -0,0 +1,144 @@
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cpp11/doubles.hpp>
+#include <cpp11/external_pointer.hpp>
+#include <cpp11/integers.hpp>
+
+#include <mcstate/random/buffer.hpp>
+#include <mcstate/random/random.hpp>
+
+// Buffers serving the uniform and normal draws of a mcstate_rng
+// object (or the rng handle used by the samplers); the generator
+// types here match those in random.cpp.
+using default_rng64 = mcstate::random::prng<mcstate::random::generator<double>>;
+using default_rng32 = mcstate::random::prng<mcstate::random::generator<float>>;
+using default_buffer64 = mcstate::random::buffered_prng<double, default_rng64>;
+using default_buffer32 = mcstate::random::buffered_prng<float, default_rng32>;
+
+template <typename T, typename B>
+SEXP mcstate_rng_buffer_alloc(SEXP ptr, int buffer, bool async) {
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  SEXP ret = PROTECT(cpp11::external_pointer<B>(new B(*rng, buffer, async)));
+  // Keep the generator alive for as long as the buffer points at it
+  R_SetExternalPtrProtected(ret, ptr);
+  UNPROTECT(1);
+  return ret;
+}
+
+// Scalar draws from a single stream are the common case (this is
+// what the samplers do at every step) so avoid the allocation and
+// threading machinery there.
+template <bool normal, typename B>
+SEXP mcstate_rng_buffer_draw(SEXP buf, int n, int n_threads) {
+  B *b = cpp11::as_cpp<cpp11::external_pointer<B>>(buf).get();
+  const int n_streams = b->size();
+  if (n == 1 && n_streams == 1) {
+    auto& s = b->stream(0);
+    return Rf_ScalarReal(normal ? s.random_normal() : s.random_real());
+  }
+
+  cpp11::writable::doubles ret = cpp11::writable::doubles(n * n_streams);
+  double * y = REAL(ret);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (int i = 0; i < n_streams; ++i) {
+    auto &s = b->stream(i);
+    auto y_i = y + n * i;
+    for (size_t j = 0; j < (size_t)n; ++j) {
+      y_i[j] = normal ? s.random_normal() : s.random_real();
+    }
+  }
+
+  if (n_streams > 1) {
+    ret.attr("dim") = cpp11::writable::integers{n, n_streams};
+  }
+  return ret;
+}
+
+template <typename B>
+void mcstate_rng_buffer_flush(SEXP buf) {
+  cpp11::as_cpp<cpp11::external_pointer<B>>(buf)->flush();
+}
+
+template <typename B>
+SEXP mcstate_rng_buffer_pending(SEXP buf) {
+  B *b = cpp11::as_cpp<cpp11::external_pointer<B>>(buf).get();
+  SEXP ret = PROTECT(Rf_allocVector(LGLSXP, b->size()));
+  for (size_t i = 0; i < b->size(); ++i) {
+    LOGICAL(ret)[i] = b->stream(i).pending();
+  }
+  UNPROTECT(1);
+  return ret;
+}
+
+template <typename B>
+cpp11::integers mcstate_rng_buffer_available(SEXP buf) {
+  B *b = cpp11::as_cpp<cpp11::external_pointer<B>>(buf).get();
+  cpp11::writable::integers ret(b->size());
+  for (size_t i = 0; i < b->size(); ++i) {
+    ret[i] = b->stream(i).available();
+  }
+  return ret;
+}
+
+[[cpp11::register]]
+SEXP mcstate_rng_buffer_alloc(SEXP ptr, int buffer, bool async,
+                              bool is_float) {
+  if (buffer < 0) {
+    cpp11::stop("'buffer' must be non-negative");
+  }
+  if (async && buffer == 0) {
+    cpp11::stop("'async' requires a positive 'buffer'");
+  }
+  return is_float ?
+    mcstate_rng_buffer_alloc<default_rng32, default_buffer32>(ptr, buffer,
+                                                              async) :
+    mcstate_rng_buffer_alloc<default_rng64, default_buffer64>(ptr, buffer,
+                                                              async);
+}
+
+[[cpp11::register]]
+SEXP mcstate_rng_buffer_random_real(SEXP buf, int n, int n_threads,
+                                    bool is_float) {
+  return is_float ?
+    mcstate_rng_buffer_draw<false, default_buffer32>(buf, n, n_threads) :
+    mcstate_rng_buffer_draw<false, default_buffer64>(buf, n, n_threads);
+}
+
+[[cpp11::register]]
+SEXP mcstate_rng_buffer_random_normal(SEXP buf, int n, int n_threads,
+                                      bool is_float) {
+  return is_float ?
+    mcstate_rng_buffer_draw<true, default_buffer32>(buf, n, n_threads) :
+    mcstate_rng_buffer_draw<true, default_buffer64>(buf, n, n_threads);
+}
+
+[[cpp11::register]]
+void mcstate_rng_buffer_flush(SEXP buf, bool is_float) {
+  if (is_float) {
+    mcstate_rng_buffer_flush<default_buffer32>(buf);
+  } else {
+    mcstate_rng_buffer_flush<default_buffer64>(buf);
+  }
+}
+
+// The number of buffered uniforms not yet used, per stream
+[[cpp11::register]]
+cpp11::integers mcstate_rng_buffer_available(SEXP buf, bool is_float) {
+  return is_float ?
+    mcstate_rng_buffer_available<default_buffer32>(buf) :
+    mcstate_rng_buffer_available<default_buffer64>(buf);
+}
+
+// Whether the next block of each stream is being generated in the
+// background
+[[cpp11::register]]
+SEXP mcstate_rng_buffer_pending(SEXP buf, bool is_float) {
+  return is_float ?
+    mcstate_rng_buffer_pending<default_buffer32>(buf) :
+    mcstate_rng_buffer_pending<default_buffer64>(buf);
+}
@@ -0,0 +1,317 @@
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cpp11/doubles.hpp>
+#include <cpp11/external_pointer.hpp>
+#include <cpp11/integers.hpp>
+
+#include <R_ext/Altrep.h>
+
+#include <mcstate/random/jump_ahead.hpp>
+#include <mcstate/random/random.hpp>
+
+// Lazy random vectors: an ALTREP real vector that holds only the
+// starting state of each stream and generates its values in blocks
+// as they are accessed. The values are laid out exactly as a draw
+// made with 'split = TRUE' (see random.cpp): block b of stream i is
+// drawn from the stream's state jumped forward by b substreams, so
+// any block can be generated without generating those before it.
+//
+// Element access (R's '[', and the region iteration used by 'sum',
+// 'mean' and friends) generates the block containing the element and
+// keeps the most recent block, so scanning through the vector costs
+// one block of memory. Anything that needs a pointer to the data
+// materialises the whole vector, generating the blocks in parallel,
+// after which the vector behaves like an ordinary one. Duplicating a
+// vector that has not been materialised gives another lazy vector
+// sharing the same streams (so 'y <- x; y[1] <- 0' materialises only
+// 'y').
+using default_rng64 = mcstate::random::prng<mcstate::random::generator<double>>;
+using default_rng32 = mcstate::random::prng<mcstate::random::generator<float>>;
+
+// This must match 'split_block_size' in random.cpp
+constexpr size_t lazy_block_size = 65536;
+
+class lazy_random {
+public:
+  lazy_random(size_t n, size_t n_streams, int n_threads) :
+    n_(n), n_streams_(n_streams), n_threads_(n_threads),
+    n_blocks_((n + lazy_block_size - 1) / lazy_block_size),
+    cache_block_(n_blocks_ * n_streams_) {
+  }
+
+  virtual ~lazy_random() = default;
+
+  R_xlen_t size() const {
+    return n_ * n_streams_;
+  }
+
+  // Blocks are numbered through all streams, with the n_blocks_
+  // blocks of the first stream first.
+  size_t block(R_xlen_t i) const {
+    const size_t j = i % n_;
+    return (i / n_) * n_blocks_ + j / lazy_block_size;
+  }
+
+  R_xlen_t block_from(size_t b) const {
+    return (b / n_blocks_) * n_ + (b % n_blocks_) * lazy_block_size;
+  }
+
+  size_t block_len(size_t b) const {
+    const size_t from = (b % n_blocks_) * lazy_block_size;
+    return std::min(from + lazy_block_size, n_) - from;
+  }
+
+  double elt(R_xlen_t i) {
+    const size_t b = block(i);
+    return cached(b)[i - block_from(b)];
+  }
+
+  R_xlen_t get_region(R_xlen_t from, R_xlen_t len, double *buf) {
+    len = std::max<R_xlen_t>(std::min(len, size() - from), 0);
+    for (R_xlen_t i = from; i < from + len;) {
+      const size_t b = block(i);
+      const R_xlen_t b_from = block_from(b);
+      const R_xlen_t b_to = b_from + block_len(b);
+      const R_xlen_t to = std::min(b_to, from + len);
+      if (i == b_from && to == b_to) {
+        fill(b, buf + (i - from));
+      } else {
+        std::copy(cached(b) + (i - b_from), cached(b) + (to - b_from),
+                  buf + (i - from));
+      }
+      i = to;
+    }
+    return len;
+  }
+
+  void materialise(double *y) {
+    const size_t n_total = n_blocks_ * n_streams_;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads_)
+#endif
+    for (size_t b = 0; b < n_total; ++b) {
+      fill(b, y + block_from(b));
+    }
+    std::vector<double>().swap(cache_);
+  }
+
+  virtual void fill(size_t b, double *y) const = 0;
+
+protected:
+  size_t n_;
+  size_t n_streams_;
+  int n_threads_;
+  size_t n_blocks_;
+
+private:
+  std::vector<double> cache_;
+  size_t cache_block_;
+
+  const double * cached(size_t b) {
+    if (b != cache_block_) {
+      cache_.resize(lazy_block_size);
+      fill(b, cache_.data());
+      cache_block_ = b;
+    }
+    return cache_.data();
+  }
+};
+
+// Draw is a function object that fills 'len' values from a state
+template <typename T, typename Draw>
+class lazy_random_draws : public lazy_random {
+public:
+  using rng_state = typename T::rng_state;
+
+  lazy_random_draws(T *rng, size_t n, int n_threads, Draw draw) :
+    lazy_random(n, rng->size(), n_threads), draw_(draw) {
+    state_.reserve(n_streams_);
+    for (size_t i = 0; i < n_streams_; ++i) {
+      state_.push_back(rng->state(i));
+      mcstate::random::substream_jump(rng->state(i), n_blocks_);
+    }
+  }
+
+  void fill(size_t b, double *y) const {
+    auto state = state_[b / n_blocks_];
+    mcstate::random::substream_jump(state, b % n_blocks_);
+    draw_(state, y, block_len(b));
+  }
+
+private:
+  std::vector<rng_state> state_;
+  Draw draw_;
+};
+
+template <typename real_type>
+struct lazy_draw_real {
+  template <typename rng_state>
+  void operator()(rng_state& state, double *y, size_t len) const {
+    for (size_t j = 0; j < len; ++j) {
+      y[j] = mcstate::random::random_real<real_type>(state);
+    }
+  }
+};
+
+template <typename real_type, mcstate::random::algorithm::normal A>
+struct lazy_draw_normal {
+  template <typename rng_state>
+  void operator()(rng_state& state, double *y, size_t len) const {
+    for (size_t j = 0; j < len; ++j) {
+      y[j] = mcstate::random::random_normal<real_type, A>(state);
+    }
+  }
+};
+
+template <typename real_type>
+struct lazy_draw_normal_pair {
+  template <typename rng_state>
+  void operator()(rng_state& state, double *y, size_t len) const {
+    mcstate::random::random_normal_box_muller_fill<real_type>(state, y, len);
+  }
+};
+
+static R_altrep_class_t lazy_random_class;
+
+lazy_random * lazy_random_data(SEXP x) {
+  return static_cast<lazy_random*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+}
+
+bool lazy_random_is_materialised(SEXP x) {
+  return R_altrep_data2(x) != R_NilValue;
+}
+
+R_xlen_t lazy_random_length(SEXP x) {
+  return lazy_random_data(x)->size();
+}
+
+void * lazy_random_dataptr(SEXP x, Rboolean writeable) {
+  if (!lazy_random_is_materialised(x)) {
+    auto obj = lazy_random_data(x);
+    SEXP y = PROTECT(Rf_allocVector(REALSXP, obj->size()));
+    obj->materialise(REAL(y));
+    R_set_altrep_data2(x, y);
+    UNPROTECT(1);
+  }
+  return REAL(R_altrep_data2(x));
+}
+
+const void * lazy_random_dataptr_or_null(SEXP x) {
+  return lazy_random_is_materialised(x) ? REAL(R_altrep_data2(x)) :
+    nullptr;
+}
+
+// Returning NULL falls back on R's own duplication, which copies the
+// materialised data. Materialisation changes nothing in the generator
+// object but its block cache, so two unmaterialised vectors can share
+// it.
+SEXP lazy_random_duplicate(SEXP x, Rboolean deep) {
+  if (lazy_random_is_materialised(x)) {
+    return NULL;
+  }
+  return R_new_altrep(lazy_random_class, R_altrep_data1(x), R_NilValue);
+}
+
+double lazy_random_elt(SEXP x, R_xlen_t i) {
+  return lazy_random_is_materialised(x) ? REAL(R_altrep_data2(x))[i] :
+    lazy_random_data(x)->elt(i);
+}
+
+R_xlen_t lazy_random_get_region(SEXP x, R_xlen_t i, R_xlen_t n, double *buf) {
+  if (lazy_random_is_materialised(x)) {
+    const R_xlen_t len = Rf_xlength(x);
+    n = std::max<R_xlen_t>(std::min(n, len - i), 0);
+    std::copy_n(REAL(R_altrep_data2(x)) + i, n, buf);
+    return n;
+  }
+  return lazy_random_data(x)->get_region(i, n, buf);
+}
+
+Rboolean lazy_random_inspect(SEXP x, int pre, int deep, int pvec,
+                             void (*inspect_subtree)(SEXP, int, int, int)) {
+  Rprintf("mcstate lazy random vector (len=%lld, materialised=%s)\n",
+          static_cast<long long>(Rf_xlength(x)),
+          lazy_random_is_materialised(x) ? "TRUE" : "FALSE");
+  return TRUE;
+}
+
+[[cpp11::init]]
+void mcstate_rng_lazy_init(DllInfo* dll) {
+  lazy_random_class =
+    R_make_altreal_class("mcstate_lazy_random", "mcstate2", dll);
+  R_set_altrep_Length_method(lazy_random_class, lazy_random_length);
+  R_set_altrep_Inspect_method(lazy_random_class, lazy_random_inspect);
+  R_set_altrep_Duplicate_method(lazy_random_class, lazy_random_duplicate);
+  R_set_altvec_Dataptr_method(lazy_random_class, lazy_random_dataptr);
+  R_set_altvec_Dataptr_or_null_method(lazy_random_class,
+                                      lazy_random_dataptr_or_null);
+  R_set_altreal_Elt_method(lazy_random_class, lazy_random_elt);
+  R_set_altreal_Get_region_method(lazy_random_class, lazy_random_get_region);
+}
+
+// The generator is left at the start of the first substream not used
+// by the vector, so that further draws are independent of it
+template <typename T, typename Draw>
+SEXP mcstate_rng_lazy(SEXP ptr, int n, int n_threads, Draw draw) {
+  if (n < 0) {
+    cpp11::stop("'n' must be non-negative");
+  }
+  T *rng = cpp11::as_cpp<cpp11::external_pointer<T>>(ptr).get();
+  const int n_streams = rng->size();
+  cpp11::external_pointer<lazy_random> data(
+    new lazy_random_draws<T, Draw>(rng, n, n_threads, draw));
+  SEXP ret = PROTECT(R_new_altrep(lazy_random_class, data, R_NilValue));
+  if (n_streams > 1) {
+    Rf_setAttrib(ret, R_DimSymbol, cpp11::writable::integers{n, n_streams});
+  }
+  UNPROTECT(1);
+  return ret;
+}
+
+[[cpp11::register]]
+SEXP mcstate_rng_lazy_random_real(SEXP ptr, int n, int n_threads,
+                                  bool is_float) {
+  return is_float ?
+    mcstate_rng_lazy<default_rng32>(ptr, n, n_threads,
+                                    lazy_draw_real<float>()) :
+    mcstate_rng_lazy<default_rng64>(ptr, n, n_threads,
+                                    lazy_draw_real<double>());
+}
+
+[[cpp11::register]]
+SEXP mcstate_rng_lazy_random_normal(SEXP ptr, int n, int n_threads,
+                                    std::string algorithm, bool is_float) {
+  using mcstate::random::algorithm::normal;
+  if (algorithm == "box_muller") {
+    return is_float ?
+      mcstate_rng_lazy<default_rng32>(
+        ptr, n, n_threads, lazy_draw_normal<float, normal::box_muller>()) :
+      mcstate_rng_lazy<default_rng64>(
+        ptr, n, n_threads, lazy_draw_normal<double, normal::box_muller>());
+  } else if (algorithm == "polar") {
+    return is_float ?
+      mcstate_rng_lazy<default_rng32>(
+        ptr, n, n_threads, lazy_draw_normal<float, normal::polar>()) :
+      mcstate_rng_lazy<default_rng64>(
+        ptr, n, n_threads, lazy_draw_normal<double, normal::polar>());
+  } else if (algorithm == "ziggurat") {
+    return is_float ?
+      mcstate_rng_lazy<default_rng32>(
+        ptr, n, n_threads, lazy_draw_normal<float, normal::ziggurat>()) :
+      mcstate_rng_lazy<default_rng64>(
+        ptr, n, n_threads, lazy_draw_normal<double, normal::ziggurat>());
+  } else if (algorithm == "box_muller_pair") {
+    return is_float ?
+      mcstate_rng_lazy<default_rng32>(ptr, n, n_threads,
+                                      lazy_draw_normal_pair<float>()) :
+      mcstate_rng_lazy<default_rng64>(ptr, n, n_threads,
+                                      lazy_draw_normal_pair<double>());
+  }
+  cpp11::stop("Unknown normal algorithm '%s'", algorithm.c_str());
+}
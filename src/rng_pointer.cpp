@@ -44,6 +44,44 @@ cpp11::sexp mcstate_rng_pointer_init(int n_streams, cpp11::sexp seed,
   return ret;
 }
 
+[[cpp11::register]]
+cpp11::sexp mcstate_rng_distributed_state_init(cpp11::sexp seed, int n_streams,
+                                               int n_nodes,
+                                               std::string algorithm) {
+  cpp11::sexp ret;
+
+  using namespace mcstate::random;
+  if (algorithm == "xoshiro256starstar") {
+    ret = r::rng_distributed_state<xoshiro256starstar>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoshiro256plusplus") {
+    ret = r::rng_distributed_state<xoshiro256plusplus>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoshiro256plus") {
+    ret = r::rng_distributed_state<xoshiro256plus>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoshiro128starstar") {
+    ret = r::rng_distributed_state<xoshiro128starstar>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoshiro128plusplus") {
+    ret = r::rng_distributed_state<xoshiro128plusplus>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoshiro128plus") {
+    ret = r::rng_distributed_state<xoshiro128plus>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoroshiro128starstar") {
+    ret = r::rng_distributed_state<xoroshiro128starstar>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoroshiro128plusplus") {
+    ret = r::rng_distributed_state<xoroshiro128plusplus>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoroshiro128plus") {
+    ret = r::rng_distributed_state<xoroshiro128plus>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoshiro512starstar") {
+    ret = r::rng_distributed_state<xoshiro512starstar>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoshiro512plusplus") {
+    ret = r::rng_distributed_state<xoshiro512plusplus>(seed, n_streams, n_nodes);
+  } else if (algorithm == "xoshiro512plus") {
+    ret = r::rng_distributed_state<xoshiro512plus>(seed, n_streams, n_nodes);
+  } else {
+    cpp11::stop("Unknown algorithm '%s'", algorithm.c_str());
+  }
+
+  return ret;
+}
+
 [[cpp11::register]]
 void mcstate_rng_pointer_sync(cpp11::environment obj, std::string algorithm) {
   using namespace mcstate::random;
@@ -74,6 +112,68 @@ void mcstate_rng_pointer_sync(cpp11::environment obj, std::string algorithm) {
   }
 }
 
+[[cpp11::register]]
+void mcstate_rng_pointer_save(cpp11::environment obj, std::string algorithm,
+                              std::string filename) {
+  using namespace mcstate::random;
+  if (algorithm == "xoshiro256starstar") {
+    r::rng_pointer_save<xoshiro256starstar>(obj, filename);
+  } else if (algorithm == "xoshiro256plusplus") {
+    r::rng_pointer_save<xoshiro256plusplus>(obj, filename);
+  } else if (algorithm == "xoshiro256plus") {
+    r::rng_pointer_save<xoshiro256plus>(obj, filename);
+  } else if (algorithm == "xoshiro128starstar") {
+    r::rng_pointer_save<xoshiro128starstar>(obj, filename);
+  } else if (algorithm == "xoshiro128plusplus") {
+    r::rng_pointer_save<xoshiro128plusplus>(obj, filename);
+  } else if (algorithm == "xoshiro128plus") {
+    r::rng_pointer_save<xoshiro128plus>(obj, filename);
+  } else if (algorithm == "xoroshiro128starstar") {
+    r::rng_pointer_save<xoroshiro128starstar>(obj, filename);
+  } else if (algorithm == "xoroshiro128plusplus") {
+    r::rng_pointer_save<xoroshiro128plusplus>(obj, filename);
+  } else if (algorithm == "xoroshiro128plus") {
+    r::rng_pointer_save<xoroshiro128plus>(obj, filename);
+  } else if (algorithm == "xoshiro512starstar") {
+    r::rng_pointer_save<xoshiro512starstar>(obj, filename);
+  } else if (algorithm == "xoshiro512plusplus") {
+    r::rng_pointer_save<xoshiro512plusplus>(obj, filename);
+  } else if (algorithm == "xoshiro512plus") {
+    r::rng_pointer_save<xoshiro512plus>(obj, filename);
+  }
+}
+
+[[cpp11::register]]
+void mcstate_rng_pointer_load(cpp11::environment obj, std::string algorithm,
+                              std::string filename) {
+  using namespace mcstate::random;
+  if (algorithm == "xoshiro256starstar") {
+    r::rng_pointer_load<xoshiro256starstar>(obj, filename);
+  } else if (algorithm == "xoshiro256plusplus") {
+    r::rng_pointer_load<xoshiro256plusplus>(obj, filename);
+  } else if (algorithm == "xoshiro256plus") {
+    r::rng_pointer_load<xoshiro256plus>(obj, filename);
+  } else if (algorithm == "xoshiro128starstar") {
+    r::rng_pointer_load<xoshiro128starstar>(obj, filename);
+  } else if (algorithm == "xoshiro128plusplus") {
+    r::rng_pointer_load<xoshiro128plusplus>(obj, filename);
+  } else if (algorithm == "xoshiro128plus") {
+    r::rng_pointer_load<xoshiro128plus>(obj, filename);
+  } else if (algorithm == "xoroshiro128starstar") {
+    r::rng_pointer_load<xoroshiro128starstar>(obj, filename);
+  } else if (algorithm == "xoroshiro128plusplus") {
+    r::rng_pointer_load<xoroshiro128plusplus>(obj, filename);
+  } else if (algorithm == "xoroshiro128plus") {
+    r::rng_pointer_load<xoroshiro128plus>(obj, filename);
+  } else if (algorithm == "xoshiro512starstar") {
+    r::rng_pointer_load<xoshiro512starstar>(obj, filename);
+  } else if (algorithm == "xoshiro512plusplus") {
+    r::rng_pointer_load<xoshiro512plusplus>(obj, filename);
+  } else if (algorithm == "xoshiro512plus") {
+    r::rng_pointer_load<xoshiro512plus>(obj, filename);
+  }
+}
+
 // This exists to check some error paths in rng_pointer_get; it is not
 // for use by users.
 [[cpp11::register]]
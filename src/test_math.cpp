@@ -0,0 +1,44 @@
+#include <string>
+#include <vector>
+
+#include <cpp11.hpp>
+
+#include <mcstate/random/math_array.hpp>
+
+template <typename real_type>
+std::vector<double> test_math_array1(const std::string& fn,
+                                     cpp11::doubles r_x) {
+  const size_t n = r_x.size();
+  std::vector<real_type> x(r_x.begin(), r_x.end());
+  std::vector<real_type> y(n);
+  if (fn == "exp") {
+    mcstate::math::exp(x.data(), y.data(), n);
+  } else if (fn == "log") {
+    mcstate::math::log(x.data(), y.data(), n);
+  } else if (fn == "log1p") {
+    mcstate::math::log1p(x.data(), y.data(), n);
+  } else if (fn == "lgamma") {
+    mcstate::math::lgamma(x.data(), y.data(), n);
+  } else if (fn == "sin" || fn == "cos") {
+    std::vector<real_type> other(n);
+    if (fn == "sin") {
+      mcstate::math::sincos(x.data(), y.data(), other.data(), n);
+    } else {
+      mcstate::math::sincos(x.data(), other.data(), y.data(), n);
+    }
+  } else if (fn == "fast_exp") {
+    mcstate::math::fast_exp(x.data(), y.data(), n);
+  } else if (fn == "fast_log") {
+    mcstate::math::fast_log(x.data(), y.data(), n);
+  } else {
+    cpp11::stop("Unknown function '%s'", fn.c_str());
+  }
+  return std::vector<double>(y.begin(), y.end());
+}
+
+[[cpp11::register]]
+std::vector<double> test_math_array(std::string fn, cpp11::doubles x,
+                                    bool is_float) {
+  return is_float ? test_math_array1<float>(fn, x) :
+    test_math_array1<double>(fn, x);
+}
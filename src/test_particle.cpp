@@ -0,0 +1,82 @@
+#include <string>
+
+#include <cpp11.hpp>
+
+#include <mcstate/r/filter.hpp>
+#include <mcstate/random/density.hpp>
+#include <mcstate/random/normal.hpp>
+
+// A gaussian random walk, observed with gaussian noise; this is
+// about the simplest model we can run a particle filter on and check
+// against the exact likelihood from a Kalman filter.
+class walk {
+public:
+  using real_type = double;
+  using rng_state_type = mcstate::random::xoshiro256plus;
+  struct data_type {
+    real_type observed;
+  };
+
+  walk(real_type sd, real_type sd_obs) : sd_(sd), sd_obs_(sd_obs) {
+  }
+
+  size_t size() const {
+    return 1;
+  }
+
+  void initial(real_type time, rng_state_type& rng_state,
+               mcstate::particle::state_view<real_type> state) const {
+    state[0] = 0;
+  }
+
+  void update(real_type time,
+              mcstate::particle::state_view<const real_type> state,
+              rng_state_type& rng_state,
+              mcstate::particle::state_view<real_type> state_next) const {
+    state_next[0] = mcstate::random::normal<real_type>(rng_state, state[0], sd_);
+  }
+
+  real_type compare(real_type time,
+                    mcstate::particle::state_view<const real_type> state,
+                    const data_type& data, rng_state_type& rng_state) const {
+    return mcstate::density::normal(data.observed, state[0], sd_obs_, true);
+  }
+
+  static walk build(cpp11::doubles pars) {
+    if (pars.size() != 2) {
+      cpp11::stop("Expected 'pars' to have length 2");
+    }
+    return walk(pars[0], pars[1]);
+  }
+
+  static data_type build_data(cpp11::list data) {
+    return data_type{cpp11::as_cpp<real_type>(data["observed"])};
+  }
+
+private:
+  real_type sd_;
+  real_type sd_obs_;
+};
+
+[[cpp11::register]]
+SEXP test_walk_filter_alloc(double time_start, cpp11::doubles time,
+                            cpp11::list data, int n_particles, int n_threads,
+                            cpp11::sexp seed, std::string method) {
+  return mcstate::r::filter_alloc<walk>(time_start, time, data, n_particles,
+                                        n_threads, seed, method);
+}
+
+[[cpp11::register]]
+double test_walk_filter_run(cpp11::sexp ptr, cpp11::doubles pars) {
+  return mcstate::r::filter_run<walk>(ptr, pars);
+}
+
+[[cpp11::register]]
+cpp11::sexp test_walk_filter_rng_state(cpp11::sexp ptr) {
+  return mcstate::r::filter_rng_state<walk>(ptr);
+}
+
+[[cpp11::register]]
+void test_walk_filter_set_rng_state(cpp11::sexp ptr, cpp11::raws state) {
+  mcstate::r::filter_set_rng_state<walk>(ptr, state);
+}
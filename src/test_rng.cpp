@@ -5,6 +5,8 @@
 #include <cpp11.hpp>
 
 #include <mcstate/random/generator.hpp>
+#include <mcstate/random/jump_ahead.hpp>
+#include <mcstate/random/random.hpp>
 #include <mcstate/r/random.hpp>
 template <typename T>
 std::string to_string(const T& t) {
@@ -66,3 +68,110 @@ std::vector<std::string> test_xoshiro_run(cpp11::environment obj) {
 
   return ret;
 }
+
+// Check jump_ahead against stepping the generator 32 times, and
+// against jump(), which is half the generator's period (in bits)
+template <typename T>
+bool test_jump_ahead1() {
+  constexpr int bits =
+    T::size() * mcstate::random::bit_size<typename T::int_type>();
+  const mcstate::random::jump_ahead<T> jump_small(5);
+  const mcstate::random::jump_ahead<T> jump_half(bits / 2);
+
+  const auto state = mcstate::random::seed<T>(42);
+  auto a = state, b = state;
+  jump_small(a);
+  for (int i = 0; i < 32; ++i) {
+    mcstate::random::next(b);
+  }
+  auto c = state, d = state;
+  jump_half(c);
+  mcstate::random::jump(d);
+  return a == b && c == d;
+}
+
+[[cpp11::register]]
+bool test_jump_ahead(std::string algorithm) {
+  if (algorithm == "xoshiro256plus") {
+    return test_jump_ahead1<mcstate::random::xoshiro256plus>();
+  } else if (algorithm == "xoshiro128plus") {
+    return test_jump_ahead1<mcstate::random::xoshiro128plus>();
+  } else if (algorithm == "xoroshiro128plus") {
+    return test_jump_ahead1<mcstate::random::xoroshiro128plus>();
+  } else if (algorithm == "xoshiro512plus") {
+    return test_jump_ahead1<mcstate::random::xoshiro512plus>();
+  }
+  cpp11::stop("Unknown algorithm '%s'", algorithm.c_str());
+}
+
+template <typename real_type, size_t n_layers>
+std::vector<double> test_ziggurat1(int n, int seed) {
+  using rng_state_type = mcstate::random::generator<real_type>;
+  mcstate::random::prng<rng_state_type> rng(1, seed, false);
+  std::vector<double> ret(n);
+  for (auto& x : ret) {
+    x = mcstate::random::random_normal_ziggurat<real_type, n_layers>(
+      rng.state(0));
+  }
+  return ret;
+}
+
+template <typename real_type>
+std::vector<double> test_ziggurat2(int n_layers, int n, int seed) {
+  switch (n_layers) {
+  case 64:
+    return test_ziggurat1<real_type, 64>(n, seed);
+  case 128:
+    return test_ziggurat1<real_type, 128>(n, seed);
+  case 256:
+    return test_ziggurat1<real_type, 256>(n, seed);
+  case 512:
+    return test_ziggurat1<real_type, 512>(n, seed);
+  case 1024:
+    return test_ziggurat1<real_type, 1024>(n, seed);
+  }
+  cpp11::stop("Unsupported number of layers %d", n_layers);
+}
+
+// Ziggurat draws with a given number of layers (a compile-time
+// choice within the package)
+[[cpp11::register]]
+std::vector<double> test_ziggurat(int n_layers, int n, int seed,
+                                  bool is_float) {
+  return is_float ? test_ziggurat2<float>(n_layers, n, seed) :
+    test_ziggurat2<double>(n_layers, n, seed);
+}
+
+template <typename real_type>
+std::vector<double> test_rejection_scalar1(std::string distribution, int n,
+                                           const std::vector<double>& a,
+                                           const std::vector<double>& b,
+                                           int n_streams, int seed) {
+  using rng_state_type = mcstate::random::generator<real_type>;
+  mcstate::random::prng<rng_state_type> rng(n_streams, seed, false);
+  std::vector<double> ret(n * n_streams);
+  for (int i = 0; i < n_streams; ++i) {
+    auto& state = rng.state(i);
+    for (int j = 0; j < n; ++j) {
+      const size_t k = i * n + j;
+      ret[k] = distribution == "binomial" ?
+        mcstate::random::binomial<real_type>(state, a[k], b[k]) :
+        mcstate::random::poisson<real_type>(state, a[k]);
+    }
+  }
+  return ret;
+}
+
+// Binomial or Poisson draws made one stream at a time, for comparison
+// with the lane-parallel samplers used by the rng object; 'a' and 'b'
+// hold the parameters of each draw, stream by stream
+[[cpp11::register]]
+std::vector<double> test_rejection_scalar(std::string distribution, int n,
+                                          std::vector<double> a,
+                                          std::vector<double> b,
+                                          int n_streams, int seed,
+                                          bool is_float) {
+  return is_float ?
+    test_rejection_scalar1<float>(distribution, n, a, b, n_streams, seed) :
+    test_rejection_scalar1<double>(distribution, n, a, b, n_streams, seed);
+}